@@ -0,0 +1,91 @@
+// ===========================================================================
+// Helpers.h // helpers shared by the benchmarks and parallel algorithms
+// ===========================================================================
+
+#pragma once
+
+import std;
+
+namespace Helpers
+{
+    // =======================================================================
+    // time measurement
+
+    // calls func once, returns its result and the elapsed time
+    template <typename TFunc>
+    auto stopwatch(TFunc&& func)
+    {
+        const auto begin{ std::chrono::steady_clock::now() };
+        auto result{ std::forward<TFunc>(func)() };
+        const auto end{ std::chrono::steady_clock::now() };
+
+        return std::pair{ std::move(result), end - begin };
+    }
+
+    // func returns a checksum of its work: the optimizer can't drop the work
+    // and the variants of an algorithm can be compared with each other
+    template <typename TFunc>
+    void measure(std::string_view label, TFunc&& func)
+    {
+        const auto [checksum, elapsed] { stopwatch(std::forward<TFunc>(func)) };
+
+        const auto msecs{ std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() };
+
+        std::println("{:<44} {:>6} msecs (checksum {})", label, msecs, checksum);
+    }
+
+    // =======================================================================
+    // fork-join on std::jthread objects
+
+    // executes func(0), ..., func(threads - 1) - func(0) on the calling thread.
+    // The first exception thrown by one of the calls is rethrown after all
+    // threads have been joined (instead of std::terminate on a worker thread)
+    template <typename TFunc>
+    void parallelFor(std::size_t threads, TFunc func)
+    {
+        std::mutex mutex{};
+        std::exception_ptr error{};
+
+        auto guarded = [&](std::size_t index) {
+            try {
+                func(index);
+            }
+            catch (...) {
+                std::lock_guard lock{ mutex };
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers{};
+            workers.reserve(threads);
+
+            for (std::size_t index{ 1 }; index < threads; ++index) {
+                workers.emplace_back(guarded, index);
+            }
+            guarded(0);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // at least MinElementsPerThread elements per thread, at most maxThreads
+    // threads (0: std::thread::hardware_concurrency())
+    inline std::size_t numberOfThreads(std::size_t size, std::size_t maxThreads = 0)
+    {
+        constexpr std::size_t MinElementsPerThread{ 100'000 };
+
+        if (maxThreads == 0) {
+            maxThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        return std::clamp<std::size_t>(size / MinElementsPerThread, 1, maxThreads);
+    }
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
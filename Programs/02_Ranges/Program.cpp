@@ -8,6 +8,18 @@ void ranges_02_views();
 void ranges_04_view_implementation();
 void ranges_05_examples();
 void ranges_06_examples();
+void ranges_07_roman_numerals();
+void ranges_08_materialization();
+void ranges_09_caching_views();
+void ranges_10_simd_chunk_view();
+void ranges_11_column_store();
+void ranges_12_group_by_aggregate();
+void ranges_13_sorting();
+void ranges_14_search_index();
+void ranges_15_simd_algorithms();
+void ranges_16_prefix_scan();
+void ranges_17_binary_conversion();
+void ranges_18_from_chars_view();
 
 int main()
 {
@@ -17,6 +29,18 @@ int main()
     ranges_04_view_implementation();
     ranges_05_examples();
     ranges_06_examples();
+    ranges_07_roman_numerals();
+    ranges_08_materialization();
+    ranges_09_caching_views();
+    ranges_10_simd_chunk_view();
+    ranges_11_column_store();
+    ranges_12_group_by_aggregate();
+    ranges_13_sorting();
+    ranges_14_search_index();
+    ranges_15_simd_algorithms();
+    ranges_16_prefix_scan();
+    ranges_17_binary_conversion();
+    ranges_18_from_chars_view();
     return 0;
 }
 
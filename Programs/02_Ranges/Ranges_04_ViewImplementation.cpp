@@ -4,6 +4,8 @@
 
 import std;
 
+#include "Helpers.h"
+
 namespace Cpp20RangesViewImplementationExample_01
 {
     // https://github.com/andreasfertig/programming-with-cpp20
@@ -187,6 +189,165 @@ namespace views
 // ===========================================================================
 // ===========================================================================
 
+namespace Cpp20RangesViewImplementationExample_03
+{
+    // A take view for production code:
+    // * the number of elements is clamped to the size of the underlying range,
+    // * end() is computed at most once (cached) for non random access ranges,
+    // * the view models sized_range, random_access_range and contiguous_range,
+    //   if the underlying range does - begin() and end() return iterators of
+    //   the underlying range,
+    // * the view is a borrowed range, if the underlying range is.
+
+    // cache, which is emptied when it is copied or moved:
+    // a cached iterator must not refer to the range of another view object
+    template <typename T>
+    class non_propagating_cache : public std::optional<T>
+    {
+    public:
+        non_propagating_cache() = default;
+        constexpr non_propagating_cache(const non_propagating_cache&) noexcept {}
+        constexpr non_propagating_cache(non_propagating_cache&& other) noexcept { other.reset(); }
+
+        constexpr non_propagating_cache& operator= (const non_propagating_cache& other) noexcept
+        {
+            if (this != &other) {
+                this->reset();
+            }
+            return *this;
+        }
+
+        constexpr non_propagating_cache& operator= (non_propagating_cache&& other) noexcept
+        {
+            this->reset();
+            other.reset();
+            return *this;
+        }
+    };
+
+    template<std::ranges::forward_range R>
+        requires std::ranges::view<R>
+    class custom_take_view
+        : public std::ranges::view_interface<custom_take_view<R>>
+    {
+    private:
+        R                                                  base_{};
+        std::ranges::range_difference_t<R>                 count_{};
+        non_propagating_cache<std::ranges::iterator_t<R>>  end_{};
+
+        // end() can be computed in O(1) without modifying the view
+        static constexpr bool FastEnd =
+            std::ranges::random_access_range<R> && std::ranges::sized_range<R>;
+
+    public:
+        custom_take_view() = default;
+
+        constexpr custom_take_view(
+            R                                  base,
+            std::ranges::range_difference_t<R> count)
+            : base_{ std::move(base) }
+            , count_{ std::max(count, std::ranges::range_difference_t<R>{}) }
+        {}
+
+        constexpr R base() const& requires std::copy_constructible<R> { return base_; }
+        constexpr R base()&& { return std::move(base_); }
+
+        constexpr auto begin() { return std::ranges::begin(base_); }
+
+        constexpr auto begin() const
+            requires std::ranges::random_access_range<const R> && std::ranges::sized_range<const R>
+        {
+            return std::ranges::begin(base_);
+        }
+
+        constexpr auto end()
+        {
+            if constexpr (FastEnd) {
+                return std::ranges::begin(base_) + static_cast<std::ranges::range_difference_t<R>>(size());
+            }
+            else {
+                if (!end_) {
+                    // bounded by the end of the underlying range
+                    end_.emplace(std::ranges::next(std::ranges::begin(base_), count_, std::ranges::end(base_)));
+                }
+                return *end_;
+            }
+        }
+
+        constexpr auto end() const
+            requires std::ranges::random_access_range<const R> && std::ranges::sized_range<const R>
+        {
+            return std::ranges::begin(base_) + static_cast<std::ranges::range_difference_t<R>>(size());
+        }
+
+        constexpr auto size() requires std::ranges::sized_range<R>
+        {
+            const auto n{ std::ranges::size(base_) };
+            return std::min(n, static_cast<decltype(n)>(count_));
+        }
+
+        constexpr auto size() const requires std::ranges::sized_range<const R>
+        {
+            const auto n{ std::ranges::size(base_) };
+            return std::min(n, static_cast<decltype(n)>(count_));
+        }
+    };
+
+    template<std::ranges::range R>
+    custom_take_view(R&& base, std::ranges::range_difference_t<R>)
+        ->custom_take_view<std::ranges::views::all_t<R>>;
+
+    namespace details {
+
+        template<std::integral T>
+        struct custom_take_range_adaptor_closure {
+            T count_;
+            constexpr custom_take_range_adaptor_closure(T count)
+                : count_{ count }
+            {}
+
+            template<std::ranges::viewable_range R>
+            constexpr auto operator()(R&& r) const
+            {
+                return custom_take_view(std::forward<R>(r), count_);
+            }
+        };
+
+        struct custom_take_range_adaptor {
+            template<typename... Args>
+            constexpr auto operator()(Args&&... args) const
+            {
+                if constexpr (sizeof...(Args) == 1) {
+                    return custom_take_range_adaptor_closure{ args... };
+                }
+                else {
+                    return custom_take_view{ std::forward<Args>(args)... };
+                }
+            }
+        };
+
+        template<std::ranges::viewable_range R, typename T>
+        constexpr auto
+            operator|(R&& r,
+                const custom_take_range_adaptor_closure<T>& a)
+        {
+            return a(std::forward<R>(r));
+        }
+    }
+}
+
+template<class R>
+constexpr bool std::ranges::enable_borrowed_range<Cpp20RangesViewImplementationExample_03::custom_take_view<R>> =
+    std::ranges::enable_borrowed_range<R>;
+
+namespace views
+{
+    inline Cpp20RangesViewImplementationExample_03::details::custom_take_range_adaptor custom_take3;
+}
+
+// ===========================================================================
+// ===========================================================================
+
 void ranges_ex_09_test_custom_view_01()
 {
     using namespace Cpp20RangesViewImplementationExample_01;
@@ -236,11 +397,94 @@ void ranges_ex_09_test_custom_view_03()
     std::cout << std::endl;
 }
 
+void ranges_ex_09_test_custom_view_04()
+{
+    using namespace Cpp20RangesViewImplementationExample_03;
+
+    std::vector<int> n{ 5, 3, 8, 1, 9, 2 };
+
+    // clamped to the size of the underlying range
+    auto v1 = n | views::custom_take3(10);
+    std::println("size: {}", v1.size());
+
+    // random access, sized and contiguous: std::ranges::sort can be applied
+    auto v2 = n | views::custom_take3(4);
+    std::ranges::sort(v2);
+
+    static_assert(std::ranges::contiguous_range<decltype(v2)>);
+    static_assert(std::ranges::sized_range<decltype(v2)>);
+    static_assert(std::ranges::borrowed_range<decltype(v2)>);
+
+    std::ranges::copy(n, std::ostream_iterator<int>(std::cout, " "));
+    std::cout << std::endl;
+
+    // non random access range: end() is computed only once
+    auto is_even = [](int const n) { return n % 2 == 0; };
+
+    auto v3 = n
+        | std::ranges::views::filter(is_even)
+        | views::custom_take3(2);
+
+    std::ranges::copy(v3, std::ostream_iterator<int>(std::cout, " "));
+    std::cout << std::endl;
+}
+
+using Helpers::measure;
+
+void ranges_ex_09_test_custom_view_05()
+{
+    // benchmark: repeated calls of end() (empty(), distance(), ...)
+    // and materialization of a view with a std::list as underlying range
+
+    constexpr int Size{ 100'000 };
+    constexpr int Calls{ 1'000 };
+
+    std::list<int> numbers(Size);
+    std::iota(numbers.begin(), numbers.end(), 0);
+
+    auto v1 = numbers | views::custom_take(Size / 2);
+    auto v2 = numbers | views::custom_take3(Size / 2);
+
+    measure("custom_take  - empty() / distance():", [&] {
+        std::size_t checksum{};
+        for (int i{}; i != Calls; ++i) {
+            checksum += v1.empty() ? 0 : 1;
+        }
+        return checksum + std::ranges::distance(v1);
+    });
+
+    measure("custom_take3 - empty() / size():", [&] {
+        std::size_t checksum{};
+        for (int i{}; i != Calls; ++i) {
+            checksum += v2.empty() ? 0 : 1;
+        }
+        return checksum + v2.size();
+    });
+
+    measure("custom_take  - std::ranges::to<std::vector>:", [&] {
+        std::size_t checksum{};
+        for (int i{}; i != Calls / 10; ++i) {
+            checksum += std::ranges::to<std::vector<int>>(v1).size();
+        }
+        return checksum;
+    });
+
+    measure("custom_take3 - std::ranges::to<std::vector>:", [&] {
+        std::size_t checksum{};
+        for (int i{}; i != Calls / 10; ++i) {
+            checksum += std::ranges::to<std::vector<int>>(v2).size();
+        }
+        return checksum;
+    });
+}
+
 void ranges_04_view_implementation()
 {
     ranges_ex_09_test_custom_view_01();
     ranges_ex_09_test_custom_view_02();
     ranges_ex_09_test_custom_view_03();
+    ranges_ex_09_test_custom_view_04();
+    ranges_ex_09_test_custom_view_05();
 }
 
 // ===========================================================================
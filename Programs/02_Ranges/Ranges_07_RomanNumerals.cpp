@@ -0,0 +1,270 @@
+// ===========================================================================
+// Ranges_07_RomanNumerals.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+// original implementation (Ranges_05_MiscExamples.cpp), used as reference
+namespace Cpp20RangesMiscellaneousExamples
+{
+    std::string toRoman(int value);
+}
+
+namespace Cpp20RangesRomanNumerals
+{
+    // =======================================================================
+    // compile-time tables: one table per decimal digit position,
+    // valid numbers are in the range [1, 3999]
+
+    constexpr int MinRoman{ 1 };
+    constexpr int MaxRoman{ 3999 };
+
+    // longest numeral in [1, 3999] is 3888 == "MMMDCCCLXXXVIII"
+    constexpr std::size_t MaxRomanLength{ 15 };
+
+    constexpr std::array<std::string_view, 4> Thousands
+    {
+        "", "M", "MM", "MMM"
+    };
+
+    constexpr std::array<std::string_view, 10> Hundreds
+    {
+        "", "C", "CC", "CCC", "CD", "D", "DC", "DCC", "DCCC", "CM"
+    };
+
+    constexpr std::array<std::string_view, 10> Tens
+    {
+        "", "X", "XX", "XXX", "XL", "L", "LX", "LXX", "LXXX", "XC"
+    };
+
+    constexpr std::array<std::string_view, 10> Ones
+    {
+        "", "I", "II", "III", "IV", "V", "VI", "VII", "VIII", "IX"
+    };
+
+    constexpr void checkRange(int value)
+    {
+        if (value < MinRoman || value > MaxRoman) {
+            throw std::out_of_range{ "Roman numerals are limited to the range [1, 3999]" };
+        }
+    }
+
+    // number of characters needed for the Roman representation of 'value'
+    constexpr std::size_t formatted_size(int value)
+    {
+        checkRange(value);
+
+        return
+            Thousands[value / 1000].size() +
+            Hundreds[(value / 100) % 10].size() +
+            Tens[(value / 10) % 10].size() +
+            Ones[value % 10].size();
+    }
+
+    // writes the Roman representation of 'value' to 'out' - doesn't allocate
+    template <std::output_iterator<char> TOut>
+    constexpr TOut format_to(TOut out, int value)
+    {
+        checkRange(value);
+
+        out = std::ranges::copy(Thousands[value / 1000], out).out;
+        out = std::ranges::copy(Hundreds[(value / 100) % 10], out).out;
+        out = std::ranges::copy(Tens[(value / 10) % 10], out).out;
+        out = std::ranges::copy(Ones[value % 10], out).out;
+
+        return out;
+    }
+
+    // drop-in replacement of the original 'toRoman':
+    // 15 characters fit into the small string buffer of all major implementations
+    std::string toRoman(int value)
+    {
+        std::array<char, MaxRomanLength> buffer{};
+        char* last{ format_to(buffer.data(), value) };
+        return std::string{ buffer.data(), last };
+    }
+
+    static_assert(formatted_size(3888) == MaxRomanLength);
+    static_assert(formatted_size(1994) == 7);   // "MCMXCIV"
+
+    // =======================================================================
+    // bulk mode: converts a whole range of numbers into one contiguous buffer
+
+    class RomanNumerals
+    {
+    private:
+        std::string              m_chars;    // all numerals, one after another
+        std::vector<std::size_t> m_offsets;  // m_offsets[i] .. m_offsets[i+1] == numeral i
+
+    public:
+        template <std::ranges::forward_range TRange>
+            requires std::integral<std::ranges::range_value_t<TRange>>
+        explicit RomanNumerals(TRange&& numbers)
+        {
+            // first pass: compute the exact size of the buffer
+            std::size_t total{};
+            std::size_t count{};
+            for (auto n : numbers) {
+                total += formatted_size(static_cast<int>(n));
+                ++count;
+            }
+
+            m_offsets.reserve(count + 1);
+            m_offsets.push_back(0);
+
+            // second pass: write all numerals without any further allocation
+            m_chars.resize(total);
+            char* first{ m_chars.data() };
+            char* pos{ first };
+            for (auto n : numbers) {
+                pos = format_to(pos, static_cast<int>(n));
+                m_offsets.push_back(static_cast<std::size_t>(pos - first));
+            }
+        }
+
+        std::size_t size() const { return m_offsets.size() - 1; }
+
+        std::string_view operator[] (std::size_t index) const
+        {
+            return std::string_view{ m_chars }.substr(
+                m_offsets[index], m_offsets[index + 1] - m_offsets[index]
+            );
+        }
+
+        // all numerals as a random access range of std::string_view objects
+        auto view() const
+        {
+            return std::views::iota(std::size_t{}, size())
+                | std::views::transform([this](std::size_t i) { return (*this)[i]; });
+        }
+
+        std::string_view chars() const { return m_chars; }
+    };
+
+    // =======================================================================
+    // examples
+
+    static void roman_01_format_to()
+    {
+        std::array<char, MaxRomanLength> buffer{};
+
+        for (int value : { 1, 4, 9, 14, 40, 90, 400, 1994, 2024, 3888, 3999 }) {
+            char* last{ format_to(buffer.data(), value) };
+            std::println("{:>4}: {}", value, std::string_view{ buffer.data(), last });
+        }
+    }
+
+    static void roman_02_transform()
+    {
+        // same as example_07 from Ranges_05_MiscExamples.cpp
+        auto range = std::views::iota(1, 51)
+            | std::views::transform([](auto i) { return toRoman(i); });
+
+        for (const auto& roman : range) {
+            std::print("{} ", roman);
+        }
+        std::println("");
+    }
+
+    static void roman_03_bulk()
+    {
+        RomanNumerals numerals{ std::views::iota(1, 51) };
+
+        std::println("{} numerals, {} characters", numerals.size(), numerals.chars().size());
+
+        for (std::string_view roman : numerals.view() | std::views::reverse | std::views::take(5)) {
+            std::print("{} ", roman);
+        }
+        std::println("");
+    }
+
+    static void roman_04_out_of_range()
+    {
+        try {
+            std::string roman{ toRoman(4000) };
+        }
+        catch (const std::out_of_range& ex) {
+            std::println("Exception: {}", ex.what());
+        }
+    }
+
+    // =======================================================================
+    // benchmark: costs per conversion
+
+    template <typename TFunc>
+    static void measure(std::string_view label, std::size_t count, TFunc func)
+    {
+        const auto [checksum, elapsed] { Helpers::stopwatch(func) };
+
+        const auto nsecs{ std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() };
+
+        std::println("{:<32} {:>8.2f} nsecs/call (checksum {})",
+            label, static_cast<double>(nsecs) / count, checksum);
+    }
+
+    static void roman_05_benchmark()
+    {
+        constexpr int Rounds{ 250 };
+
+        constexpr std::size_t Count{ static_cast<std::size_t>(Rounds) * MaxRoman };
+
+        auto numbers = std::views::iota(MinRoman, MaxRoman + 1);
+
+        measure("toRoman (Ranges_05):", Count, [&] {
+            std::size_t checksum{};
+            for (int round{}; round != Rounds; ++round) {
+                for (int n : numbers) {
+                    checksum += Cpp20RangesMiscellaneousExamples::toRoman(n).size();
+                }
+            }
+            return checksum;
+        });
+
+        measure("toRoman (constexpr tables):", Count, [&] {
+            std::size_t checksum{};
+            for (int round{}; round != Rounds; ++round) {
+                for (int n : numbers) {
+                    checksum += toRoman(n).size();
+                }
+            }
+            return checksum;
+        });
+
+        measure("format_to (no allocation):", Count, [&] {
+            std::array<char, MaxRomanLength> buffer{};
+            std::size_t checksum{};
+            for (int round{}; round != Rounds; ++round) {
+                for (int n : numbers) {
+                    checksum += static_cast<std::size_t>(format_to(buffer.data(), n) - buffer.data());
+                }
+            }
+            return checksum;
+        });
+
+        measure("RomanNumerals (bulk mode):", Count, [&] {
+            std::size_t checksum{};
+            for (int round{}; round != Rounds; ++round) {
+                RomanNumerals numerals{ numbers };
+                checksum += numerals.chars().size();
+            }
+            return checksum;
+        });
+    }
+}
+
+void ranges_07_roman_numerals()
+{
+    using namespace Cpp20RangesRomanNumerals;
+
+    roman_01_format_to();
+    roman_02_transform();
+    roman_03_bulk();
+    roman_04_out_of_range();
+    roman_05_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
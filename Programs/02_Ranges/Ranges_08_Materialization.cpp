@@ -0,0 +1,285 @@
+// ===========================================================================
+// Ranges_08_Materialization.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesMaterialization
+{
+    // =======================================================================
+    // helper functions from Ranges_05_MiscExamples.cpp (used as reference):
+    // non-sized ranges are traversed twice, input ranges can't be used at all
+
+    auto toVectorClassic(auto&& r)
+    {
+        std::vector<std::ranges::range_value_t<decltype(r)>> vec;
+
+        if constexpr (std::ranges::sized_range<decltype(r)>) {
+            vec.reserve(std::ranges::size(r));
+        }
+        else {
+            vec.reserve(std::distance(r.begin(), r.end()));
+        }
+
+        std::ranges::copy(r, std::back_inserter(vec));
+        return vec;
+    }
+
+    auto toStringClassic(auto&& r)
+    {
+        std::string result{};
+        if constexpr (std::ranges::sized_range<decltype(r)>) {
+            result.reserve(std::ranges::size(r));
+        }
+        else {
+            result.reserve(std::distance(r.begin(), r.end()));
+        }
+
+        std::ranges::copy(r, std::back_inserter(result));
+        return result;
+    }
+
+    // =======================================================================
+    // materialize: the strategy depends on the category of the range
+
+    template <typename TContainer, typename TRange>
+    concept BulkCopyable =
+        std::ranges::contiguous_range<TRange> &&
+        std::ranges::sized_range<TRange> &&
+        std::same_as<std::ranges::range_value_t<TRange>, typename TContainer::value_type> &&
+        std::is_trivially_copyable_v<typename TContainer::value_type>;
+
+    // strategy 1: contiguous source of trivially copyable elements - one memcpy
+    template <typename TContainer, typename TRange>
+        requires BulkCopyable<TContainer, TRange>
+    void appendBulk(TContainer& container, TRange&& range)
+    {
+        using ValueType = typename TContainer::value_type;
+
+        const auto count{ static_cast<std::size_t>(std::ranges::size(range)) };
+        const auto* source{ std::ranges::data(range) };
+        const std::size_t offset{ container.size() };
+
+        if (count == 0) {
+            return;
+        }
+
+        if constexpr (requires { container.resize_and_overwrite(count, [](ValueType*, std::size_t n) { return n; }); }) {
+            // std::basic_string: no value-initialization of the new characters
+            container.resize_and_overwrite(offset + count, [=](ValueType* data, std::size_t n) {
+                std::memcpy(data + offset, source, count * sizeof(ValueType));
+                return n;
+            });
+        }
+        else {
+            container.resize(offset + count);
+            std::memcpy(container.data() + offset, source, count * sizeof(ValueType));
+        }
+    }
+
+    // strategy 2: sized range - exact reservation, single pass
+    template <typename TContainer, std::ranges::sized_range TRange>
+    void appendSized(TContainer& container, TRange&& range)
+    {
+        container.reserve(container.size() + static_cast<std::size_t>(std::ranges::size(range)));
+
+        if constexpr (requires { container.append_range(range); }) {
+            container.append_range(range);
+        }
+        else {
+            for (auto&& elem : range) {
+                container.push_back(std::forward<decltype(elem)>(elem));
+            }
+        }
+    }
+
+    // strategy 3: single-pass input range - elements are collected in chunks
+    // of geometrically growing size. Each element is moved exactly twice (into
+    // its chunk, then into the container): a full chunk is never reallocated,
+    // unlike a growing std::vector, and the container gets an exact capacity
+    template <typename TContainer, std::ranges::input_range TRange>
+    void appendChunked(TContainer& container, TRange&& range)
+    {
+        using ValueType = typename TContainer::value_type;
+
+        constexpr std::size_t FirstChunkSize{ 64 };
+
+        std::vector<std::vector<ValueType>> chunks{};
+        std::size_t chunkSize{ FirstChunkSize };
+        std::size_t total{};
+
+        chunks.emplace_back().reserve(chunkSize);
+
+        for (auto&& elem : range) {
+            if (chunks.back().size() == chunkSize) {
+                chunkSize *= 2;
+                chunks.emplace_back().reserve(chunkSize);
+            }
+            chunks.back().push_back(std::forward<decltype(elem)>(elem));
+            ++total;
+        }
+
+        container.reserve(container.size() + total);
+
+        for (auto& chunk : chunks) {
+            if constexpr (BulkCopyable<TContainer, std::vector<ValueType>&>) {
+                appendBulk(container, chunk);
+            }
+            else {
+                std::ranges::move(chunk, std::back_inserter(container));
+            }
+        }
+    }
+
+    template <typename TContainer, std::ranges::input_range TRange>
+    TContainer materialize(TRange&& range)
+    {
+        TContainer container{};
+
+        if constexpr (BulkCopyable<TContainer, TRange>) {
+            appendBulk(container, range);
+        }
+        else if constexpr (std::ranges::sized_range<TRange>) {
+            appendSized(container, range);
+        }
+        else if constexpr (std::ranges::forward_range<TRange>) {
+            // no std::distance walk: the container grows geometrically by itself
+            for (auto&& elem : range) {
+                container.push_back(std::forward<decltype(elem)>(elem));
+            }
+        }
+        else {
+            appendChunked(container, range);
+        }
+
+        return container;
+    }
+
+    template <std::ranges::input_range TRange>
+    auto toVector(TRange&& range)
+    {
+        return materialize<std::vector<std::ranges::range_value_t<TRange>>>(std::forward<TRange>(range));
+    }
+
+    template <std::ranges::input_range TRange>
+    auto toString(TRange&& range)
+    {
+        return materialize<std::string>(std::forward<TRange>(range));
+    }
+
+    // =======================================================================
+    // examples
+
+    static void printRange(std::string_view msg, auto&& range)
+    {
+        std::print("{}", msg);
+
+        for (const auto& elem : range) {
+            std::print("{} ", elem);
+        }
+        std::println("");
+    }
+
+    static void materialize_01_strategies()
+    {
+        // contiguous range: bulk copy
+        auto numbers = std::vector{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        auto copy{ toVector(numbers) };
+        printRange("Contiguous: ", copy);
+
+        // sized range: exact reservation
+        auto squares{ toVector(numbers | std::views::transform([](int n) { return n * n; })) };
+        printRange("Sized:      ", squares);
+        std::println("Capacity:   {}", squares.capacity());
+
+        // non-sized forward range: single pass
+        int calls{};
+        auto isEven = [&](int n) { ++calls; return n % 2 == 0; };
+        auto even{ toVector(numbers | std::views::filter(isEven)) };
+        printRange("Filtered:   ", even);
+        std::println("Predicate calls: {}", calls);
+
+        calls = 0;
+        auto evenClassic{ toVectorClassic(numbers | std::views::filter(isEven)) };
+        printRange("Classic:    ", evenClassic);
+        std::println("Predicate calls: {}", calls);
+    }
+
+    static void materialize_02_input_range()
+    {
+        // single-pass input range: toVectorClassic doesn't compile (std::distance)
+        std::istringstream input{ "1 2 3 4 5 6 7 8 9 10 11 12" };
+
+        auto values{ toVector(std::views::istream<int>(input)) };
+        printRange("From stream: ", values);
+    }
+
+    static void materialize_03_strings()
+    {
+        std::vector<std::string> words{
+            "Lorem", "-", "ipsum", "-",
+            "dolor", "-", "sit", "-",
+            "amet"
+        };
+
+        std::string text{ toString(words | std::views::join) };
+        std::println("{}", text);
+
+        std::string text2{ "The-quick-brown-fox-jumps-over-the-lazy-dog" };
+
+        auto range = text2 | std::views::split('-') | std::views::transform([](auto&& s) {
+            return toString(s);     // a split subrange is contiguous: bulk copy
+        });
+
+        printRange("Words: ", toVector(range));
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    static void materialize_04_benchmark()
+    {
+        constexpr std::size_t Size{ 10'000'000 };
+
+        std::vector<int> numbers(Size);
+        std::iota(numbers.begin(), numbers.end(), 0);
+
+        auto filtered = numbers | std::views::filter([](int n) { return n % 3 != 0; });
+
+        std::println("Contiguous range ({} ints):", Size);
+        measure("  toVectorClassic:", [&] { return toVectorClassic(numbers).size(); });
+        measure("  std::ranges::to:", [&] { return std::ranges::to<std::vector<int>>(numbers).size(); });
+        measure("  toVector:", [&] { return toVector(numbers).size(); });
+
+        std::println("Filtered range (non-sized):");
+        measure("  toVectorClassic:", [&] { return toVectorClassic(filtered).size(); });
+        measure("  std::ranges::to:", [&] { return std::ranges::to<std::vector<int>>(filtered).size(); });
+        measure("  toVector:", [&] { return toVector(filtered).size(); });
+
+        std::vector<std::string> words(Size / 10, std::string{ "Lorem ipsum " });
+        auto joined = words | std::views::join;
+
+        std::println("Joined strings ({} words):", words.size());
+        measure("  toStringClassic:", [&] { return toStringClassic(joined).size(); });
+        measure("  std::ranges::to:", [&] { return std::ranges::to<std::string>(joined).size(); });
+        measure("  toString:", [&] { return toString(joined).size(); });
+    }
+}
+
+void ranges_08_materialization()
+{
+    using namespace Cpp20RangesMaterialization;
+
+    materialize_01_strategies();
+    materialize_02_input_range();
+    materialize_03_strings();
+    materialize_04_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,503 @@
+// ===========================================================================
+// Ranges_09_CachingViews.cpp
+// ===========================================================================
+
+import std;
+
+// constexpr tables implementation (Ranges_07_RomanNumerals.cpp)
+namespace Cpp20RangesRomanNumerals
+{
+    std::string toRoman(int value);
+}
+
+namespace Cpp20RangesCachingViews
+{
+    // =======================================================================
+    // cache_latest_view: caches the result of dereferencing the current
+    // element of the underlying range. The result is an input range,
+    // a subsequent 'filter' or 'take_while' doesn't invoke an expensive
+    // 'transform' twice per element any more.
+
+    template<std::ranges::input_range V>
+        requires std::ranges::view<V>
+    class cache_latest_view
+        : public std::ranges::view_interface<cache_latest_view<V>>
+    {
+    private:
+        using base_reference_t = std::ranges::range_reference_t<V>;
+
+        // lvalue references are cached as pointer, prvalues as value
+        using cache_t = std::conditional_t<
+            std::is_reference_v<base_reference_t>,
+            std::add_pointer_t<base_reference_t>,
+            base_reference_t
+        >;
+
+        V                      base_{};
+        std::optional<cache_t> cache_{};
+
+        class sentinel;
+
+        class iterator
+        {
+        private:
+            cache_latest_view*          parent_{};
+            std::ranges::iterator_t<V>  current_{};
+
+        public:
+            using difference_type  = std::ranges::range_difference_t<V>;
+            using value_type       = std::ranges::range_value_t<V>;
+            using iterator_concept = std::input_iterator_tag;
+
+            iterator() = default;
+
+            constexpr iterator(cache_latest_view* parent, std::ranges::iterator_t<V> current)
+                : parent_{ parent }, current_{ std::move(current) }
+            {}
+
+            iterator(iterator&&) = default;
+            iterator& operator= (iterator&&) = default;
+
+            constexpr const std::ranges::iterator_t<V>& base() const& { return current_; }
+
+            constexpr auto& operator* () const
+            {
+                auto& cache{ parent_->cache_ };
+
+                if constexpr (std::is_reference_v<base_reference_t>) {
+                    if (!cache) {
+                        cache.emplace(std::addressof(*current_));
+                    }
+                    return **cache;
+                }
+                else {
+                    if (!cache) {
+                        cache.emplace(*current_);
+                    }
+                    return *cache;
+                }
+            }
+
+            constexpr iterator& operator++ ()
+            {
+                ++current_;
+                parent_->cache_.reset();
+                return *this;
+            }
+
+            constexpr void operator++ (int) { ++*this; }
+        };
+
+        class sentinel
+        {
+        private:
+            std::ranges::sentinel_t<V> end_{};
+
+        public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(std::ranges::sentinel_t<V> end)
+                : end_{ std::move(end) }
+            {}
+
+            friend constexpr bool operator== (const iterator& it, const sentinel& s)
+            {
+                return it.base() == s.end_;
+            }
+        };
+
+    public:
+        cache_latest_view() = default;
+
+        constexpr explicit cache_latest_view(V base)
+            : base_{ std::move(base) }
+        {}
+
+        constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+        constexpr V base()&& { return std::move(base_); }
+
+        constexpr auto begin()
+        {
+            cache_.reset();
+            return iterator{ this, std::ranges::begin(base_) };
+        }
+
+        constexpr auto end() { return sentinel{ std::ranges::end(base_) }; }
+
+        constexpr auto size() requires std::ranges::sized_range<V>
+        {
+            return std::ranges::size(base_);
+        }
+    };
+
+    template<class R>
+    cache_latest_view(R&&) -> cache_latest_view<std::ranges::views::all_t<R>>;
+
+    // =======================================================================
+    // memoize_view: stores each computed element in a side buffer indexed
+    // by its position. Multi-pass algorithms (max_element, reverse, several
+    // loops over the same view, ...) compute every element only once.
+    // The view keeps the iterator category of the underlying range.
+    // The buffer is shared by all copies of the view: copying stays O(1).
+
+    template<std::ranges::forward_range V>
+        requires std::ranges::view<V> && std::copy_constructible<std::ranges::range_value_t<V>>
+    class memoize_view
+        : public std::ranges::view_interface<memoize_view<V>>
+    {
+    private:
+        using value_t = std::ranges::range_value_t<V>;
+        using difference_t = std::ranges::range_difference_t<V>;
+
+        struct storage_t
+        {
+            std::deque<std::optional<value_t>> values_{};  // deque: growing doesn't invalidate references
+            std::optional<difference_t>        size_{};    // number of elements, computed at most once
+        };
+
+        // position of the end, as long as it hasn't been counted
+        static constexpr difference_t UnknownIndex{ -1 };
+
+        V                          base_{};
+        std::shared_ptr<storage_t> cache_{ std::make_shared<storage_t>() };
+
+        constexpr const value_t& get(difference_t index, const std::ranges::iterator_t<V>& it)
+        {
+            auto& values{ cache_->values_ };
+            const auto pos{ static_cast<std::size_t>(index) };
+
+            if (pos >= values.size()) {
+                values.resize(pos + 1);
+            }
+
+            auto& slot{ values[pos] };
+            if (!slot) {
+                slot.emplace(*it);
+            }
+
+            return *slot;
+        }
+
+        constexpr difference_t count()
+        {
+            auto& size{ cache_->size_ };
+            if (!size) {
+                size = static_cast<difference_t>(std::ranges::distance(base_));
+            }
+
+            return *size;
+        }
+
+        class iterator
+        {
+        private:
+            memoize_view*              parent_{};
+            std::ranges::iterator_t<V> current_{};
+            difference_t               index_{};
+
+        public:
+            using difference_type  = difference_t;
+            using value_type       = value_t;
+            using reference        = const value_t&;
+            using iterator_concept = std::conditional_t<
+                std::ranges::random_access_range<V>,
+                std::random_access_iterator_tag,
+                std::conditional_t<
+                    std::ranges::bidirectional_range<V>,
+                    std::bidirectional_iterator_tag,
+                    std::forward_iterator_tag
+                >
+            >;
+            using iterator_category = iterator_concept;
+
+            iterator() = default;
+
+            constexpr iterator(memoize_view* parent, std::ranges::iterator_t<V> current, difference_t index)
+                : parent_{ parent }, current_{ std::move(current) }, index_{ index }
+            {}
+
+            constexpr reference operator* () const { return parent_->get(index_, current_); }
+
+            constexpr iterator& operator++ ()
+            {
+                ++current_;
+                ++index_;
+                return *this;
+            }
+
+            constexpr iterator operator++ (int)
+            {
+                auto tmp{ *this };
+                ++*this;
+                return tmp;
+            }
+
+            constexpr iterator& operator-- () requires std::ranges::bidirectional_range<V>
+            {
+                if (index_ == UnknownIndex) {
+                    index_ = parent_->count();
+                }
+
+                --current_;
+                --index_;
+                return *this;
+            }
+
+            constexpr iterator operator-- (int) requires std::ranges::bidirectional_range<V>
+            {
+                auto tmp{ *this };
+                --*this;
+                return tmp;
+            }
+
+            constexpr iterator& operator+= (difference_type n) requires std::ranges::random_access_range<V>
+            {
+                current_ += n;
+                index_ += n;
+                return *this;
+            }
+
+            constexpr iterator& operator-= (difference_type n) requires std::ranges::random_access_range<V>
+            {
+                return *this += -n;
+            }
+
+            constexpr reference operator[] (difference_type n) const requires std::ranges::random_access_range<V>
+            {
+                return *(*this + n);
+            }
+
+            friend constexpr iterator operator+ (iterator it, difference_type n) requires std::ranges::random_access_range<V>
+            {
+                return it += n;
+            }
+
+            friend constexpr iterator operator+ (difference_type n, iterator it) requires std::ranges::random_access_range<V>
+            {
+                return it += n;
+            }
+
+            friend constexpr iterator operator- (iterator it, difference_type n) requires std::ranges::random_access_range<V>
+            {
+                return it -= n;
+            }
+
+            friend constexpr difference_type operator- (const iterator& x, const iterator& y) requires std::ranges::random_access_range<V>
+            {
+                return x.index_ - y.index_;
+            }
+
+            friend constexpr bool operator== (const iterator& x, const iterator& y)
+            {
+                return x.current_ == y.current_;
+            }
+
+            friend constexpr auto operator<=> (const iterator& x, const iterator& y) requires std::ranges::random_access_range<V>
+            {
+                return x.index_ <=> y.index_;
+            }
+
+            friend constexpr bool operator== (const iterator& it, const std::ranges::sentinel_t<V>& end)
+                requires (not std::ranges::common_range<V>)
+            {
+                return it.current_ == end;
+            }
+        };
+
+    public:
+        memoize_view() = default;
+
+        constexpr explicit memoize_view(V base)
+            : base_{ std::move(base) }
+        {}
+
+        constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+        constexpr V base()&& { return std::move(base_); }
+
+        constexpr auto begin() { return iterator{ this, std::ranges::begin(base_), 0 }; }
+
+        constexpr auto end()
+        {
+            if constexpr (std::ranges::common_range<V>) {
+                // the position of the end is needed for decrementing: it's known
+                // in advance for sized ranges, otherwise it's counted once by the
+                // first decrement of an end iterator - end() itself stays O(1)
+                if constexpr (std::ranges::sized_range<V> ||
+                              std::sized_sentinel_for<std::ranges::iterator_t<V>, std::ranges::iterator_t<V>>) {
+                    return iterator{ this, std::ranges::end(base_), static_cast<difference_t>(std::ranges::distance(base_)) };
+                }
+                else {
+                    return iterator{ this, std::ranges::end(base_), UnknownIndex };
+                }
+            }
+            else {
+                return std::ranges::end(base_);
+            }
+        }
+
+        constexpr auto size() requires std::ranges::sized_range<V>
+        {
+            return std::ranges::size(base_);
+        }
+    };
+
+    template<class R>
+    memoize_view(R&&) -> memoize_view<std::ranges::views::all_t<R>>;
+
+    // =======================================================================
+    // range adaptor objects
+
+    namespace details
+    {
+        struct cache_latest_range_adaptor
+        {
+            template <std::ranges::viewable_range R>
+            constexpr auto operator () (R&& r) const
+            {
+                return cache_latest_view{ std::forward<R>(r) };
+            }
+        };
+
+        struct memoize_range_adaptor
+        {
+            template <std::ranges::viewable_range R>
+            constexpr auto operator () (R&& r) const
+            {
+                return memoize_view{ std::forward<R>(r) };
+            }
+        };
+
+        template <std::ranges::viewable_range R>
+        constexpr auto operator | (R&& r, const cache_latest_range_adaptor& a)
+        {
+            return a(std::forward<R>(r));
+        }
+
+        template <std::ranges::viewable_range R>
+        constexpr auto operator | (R&& r, const memoize_range_adaptor& a)
+        {
+            return a(std::forward<R>(r));
+        }
+    }
+}
+
+namespace views
+{
+    inline Cpp20RangesCachingViews::details::cache_latest_range_adaptor cache_latest;
+    inline Cpp20RangesCachingViews::details::memoize_range_adaptor memoize;
+}
+
+// ===========================================================================
+// ===========================================================================
+
+namespace Cpp20RangesCachingViews
+{
+    // 'toRoman' of Ranges_07_RomanNumerals.cpp, counting its invocations
+    static int calls{};
+
+    static std::string toRoman(int value)
+    {
+        ++calls;
+        return Cpp20RangesRomanNumerals::toRoman(value);
+    }
+
+    static void caching_01_transform_filter()
+    {
+        auto isShort = [](const std::string& s) { return s.size() <= 2; };
+
+        // 'filter' dereferences each element for the predicate,
+        // the loop dereferences the accepted elements a second time
+        calls = 0;
+        auto range1 = std::views::iota(1, 51)
+            | std::views::transform(toRoman)
+            | std::views::filter(isShort);
+
+        for (const auto& roman : range1) {
+            std::print("{} ", roman);
+        }
+        std::println("\ntransform | filter:                {} calls", calls);
+
+        calls = 0;
+        auto range2 = std::views::iota(1, 51)
+            | std::views::transform(toRoman)
+            | views::cache_latest
+            | std::views::filter(isShort);
+
+        for (const auto& roman : range2) {
+            std::print("{} ", roman);
+        }
+        std::println("\ntransform | cache_latest | filter: {} calls", calls);
+    }
+
+    static void caching_02_reverse_take()
+    {
+        // same as example_08 from Ranges_05_MiscExamples.cpp,
+        // the view is iterated twice
+        auto print = [](auto&& range) {
+            for (const auto& roman : range) {
+                std::print("{} ", roman);
+            }
+            std::println("");
+        };
+
+        calls = 0;
+        auto range1 = std::views::iota(1, 50)
+            | std::views::filter([](auto i) { return i % 7 == 0; })
+            | std::views::transform(toRoman)
+            | std::views::reverse
+            | std::views::take(3);
+
+        print(range1);
+        print(range1);
+        std::println("transform | reverse | take:           {} calls", calls);
+
+        calls = 0;
+        auto range2 = std::views::iota(1, 50)
+            | std::views::filter([](auto i) { return i % 7 == 0; })
+            | std::views::transform(toRoman)
+            | views::memoize
+            | std::views::reverse
+            | std::views::take(3);
+
+        print(range2);
+        print(range2);
+        std::println("transform | memoize | reverse | take: {} calls", calls);
+    }
+
+    static void caching_03_multi_pass()
+    {
+        auto bySize = [](const std::string& s) { return s.size(); };
+
+        calls = 0;
+        auto range1 = std::views::iota(1, 1001) | std::views::transform(toRoman);
+
+        auto longest1{ *std::ranges::max_element(range1, {}, bySize) };
+        auto count1{ std::ranges::count_if(range1, [](const auto& s) { return s.starts_with('C'); }) };
+        auto sorted1{ std::ranges::is_sorted(range1) };
+        std::println("{} {} {} - transform:           {} calls", longest1, count1, sorted1, calls);
+
+        calls = 0;
+        auto range2 = std::views::iota(1, 1001) | std::views::transform(toRoman) | views::memoize;
+
+        auto longest2{ *std::ranges::max_element(range2, {}, bySize) };
+        auto count2{ std::ranges::count_if(range2, [](const auto& s) { return s.starts_with('C'); }) };
+        auto sorted2{ std::ranges::is_sorted(range2) };
+        std::println("{} {} {} - transform | memoize: {} calls", longest2, count2, sorted2, calls);
+
+        static_assert(std::ranges::random_access_range<decltype(range2)>);
+        static_assert(std::ranges::sized_range<decltype(range2)>);
+    }
+}
+
+void ranges_09_caching_views()
+{
+    using namespace Cpp20RangesCachingViews;
+
+    caching_01_transform_filter();
+    caching_02_reverse_take();
+    caching_03_multi_pass();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
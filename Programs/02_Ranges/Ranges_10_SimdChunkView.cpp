@@ -0,0 +1,441 @@
+// ===========================================================================
+// Ranges_10_SimdChunkView.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_CHUNKS_SSE2
+#include <immintrin.h>
+#endif
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesSimdChunks
+{
+    // =======================================================================
+    // native vector types: SSE2 is available on every x64 processor,
+    // other platforms use a scalar emulation with the same interface
+
+    template <typename T>
+    concept SimdArithmetic =
+        std::same_as<T, int> || std::same_as<T, float> || std::same_as<T, double>;
+
+    template <SimdArithmetic T>
+    struct simd_traits;
+
+#if defined(SIMD_CHUNKS_SSE2)
+
+    template <>
+    struct simd_traits<int>
+    {
+        using native_type = __m128i;
+        static constexpr std::size_t size{ 4 };
+
+        static native_type load(const int* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void store(int* p, native_type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+        static native_type broadcast(int value) { return _mm_set1_epi32(value); }
+        static native_type add(native_type a, native_type b) { return _mm_add_epi32(a, b); }
+        static native_type sub(native_type a, native_type b) { return _mm_sub_epi32(a, b); }
+
+        static native_type mul(native_type a, native_type b)
+        {
+            // SSE2 has no 32-bit multiplication: multiply even and odd lanes separately
+            __m128i even{ _mm_mul_epu32(a, b) };
+            __m128i odd{ _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4)) };
+            return _mm_unpacklo_epi32(
+                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))
+            );
+        }
+
+        static unsigned greater(native_type a, native_type b)
+        {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, b))));
+        }
+    };
+
+    template <>
+    struct simd_traits<float>
+    {
+        using native_type = __m128;
+        static constexpr std::size_t size{ 4 };
+
+        static native_type load(const float* p) { return _mm_load_ps(p); }
+        static void store(float* p, native_type v) { _mm_storeu_ps(p, v); }
+        static native_type broadcast(float value) { return _mm_set1_ps(value); }
+        static native_type add(native_type a, native_type b) { return _mm_add_ps(a, b); }
+        static native_type sub(native_type a, native_type b) { return _mm_sub_ps(a, b); }
+        static native_type mul(native_type a, native_type b) { return _mm_mul_ps(a, b); }
+
+        static unsigned greater(native_type a, native_type b)
+        {
+            return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpgt_ps(a, b)));
+        }
+    };
+
+    template <>
+    struct simd_traits<double>
+    {
+        using native_type = __m128d;
+        static constexpr std::size_t size{ 2 };
+
+        static native_type load(const double* p) { return _mm_load_pd(p); }
+        static void store(double* p, native_type v) { _mm_storeu_pd(p, v); }
+        static native_type broadcast(double value) { return _mm_set1_pd(value); }
+        static native_type add(native_type a, native_type b) { return _mm_add_pd(a, b); }
+        static native_type sub(native_type a, native_type b) { return _mm_sub_pd(a, b); }
+        static native_type mul(native_type a, native_type b) { return _mm_mul_pd(a, b); }
+
+        static unsigned greater(native_type a, native_type b)
+        {
+            return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(a, b)));
+        }
+    };
+
+#else
+
+    template <SimdArithmetic T>
+    struct simd_traits
+    {
+        static constexpr std::size_t size{ 16 / sizeof(T) };
+        using native_type = std::array<T, size>;
+
+        static native_type load(const T* p) { native_type v; std::copy_n(p, size, v.begin()); return v; }
+        static void store(T* p, const native_type& v) { std::ranges::copy(v, p); }
+        static native_type broadcast(T value) { native_type v; v.fill(value); return v; }
+
+        template <typename TOp>
+        static native_type apply(const native_type& a, const native_type& b, TOp op)
+        {
+            native_type v;
+            std::ranges::transform(a, b, v.begin(), op);
+            return v;
+        }
+
+        static native_type add(const native_type& a, const native_type& b) { return apply(a, b, std::plus{}); }
+        static native_type sub(const native_type& a, const native_type& b) { return apply(a, b, std::minus{}); }
+        static native_type mul(const native_type& a, const native_type& b) { return apply(a, b, std::multiplies{}); }
+
+        static unsigned greater(const native_type& a, const native_type& b)
+        {
+            unsigned bits{};
+            for (std::size_t i{}; i != size; ++i) {
+                bits |= (a[i] > b[i] ? 1u : 0u) << i;
+            }
+            return bits;
+        }
+    };
+
+#endif
+
+    // =======================================================================
+    // simd_batch: fixed number of elements processed by one instruction,
+    // provides the same operators as T - generic lambdas accept both
+
+    template <SimdArithmetic T>
+    class simd_batch
+    {
+    private:
+        using traits = simd_traits<T>;
+        using native_type = typename traits::native_type;
+
+        native_type m_value;
+
+        explicit simd_batch(native_type value) : m_value{ value } {}
+
+    public:
+        static constexpr std::size_t size{ traits::size };
+        static constexpr std::size_t alignment{ sizeof(T) * size };
+
+        simd_batch() : m_value{ traits::broadcast(T{}) } {}
+        simd_batch(T value) : m_value{ traits::broadcast(value) } {}
+
+        // 'p' must be aligned to 'alignment'
+        static simd_batch load(const T* p) { return simd_batch{ traits::load(p) }; }
+
+        void store(T* p) const { traits::store(p, m_value); }
+
+        friend simd_batch operator+ (simd_batch a, simd_batch b) { return simd_batch{ traits::add(a.m_value, b.m_value) }; }
+        friend simd_batch operator- (simd_batch a, simd_batch b) { return simd_batch{ traits::sub(a.m_value, b.m_value) }; }
+        friend simd_batch operator* (simd_batch a, simd_batch b) { return simd_batch{ traits::mul(a.m_value, b.m_value) }; }
+
+        // bit i is set, if element i of 'a' is greater than element i of 'b'
+        friend unsigned greater_mask(simd_batch a, simd_batch b) { return traits::greater(a.m_value, b.m_value); }
+
+        T reduce() const
+        {
+            std::array<T, size> values{};
+            store(values.data());
+            return std::accumulate(values.begin(), values.end(), T{});
+        }
+    };
+
+    // =======================================================================
+    // chunk_simd_view: presents a contiguous range of arithmetic elements as
+    //   * a scalar head up to the first aligned address,
+    //   * a random access range of aligned simd_batch<T> chunks and
+    //   * a scalar tail
+
+    template <SimdArithmetic T>
+    class chunk_simd_view
+        : public std::ranges::view_interface<chunk_simd_view<T>>
+    {
+    private:
+        struct load_chunk
+        {
+            const T* m_first{};
+
+            simd_batch<T> operator() (std::size_t index) const
+            {
+                return simd_batch<T>::load(m_first + index * simd_batch<T>::size);
+            }
+        };
+
+        using chunks_t = std::ranges::transform_view<std::ranges::iota_view<std::size_t, std::size_t>, load_chunk>;
+
+        std::span<const T> m_head{};
+        std::span<const T> m_body{};
+        std::span<const T> m_tail{};
+        chunks_t           m_chunks{};
+
+    public:
+        chunk_simd_view() = default;
+
+        explicit chunk_simd_view(std::span<const T> range)
+        {
+            constexpr std::size_t Alignment{ simd_batch<T>::alignment };
+
+            const auto address{ reinterpret_cast<std::uintptr_t>(range.data()) };
+            const auto misalignment{ address % Alignment };
+
+            std::size_t headSize{ misalignment == 0 ? 0 : (Alignment - misalignment) / sizeof(T) };
+            headSize = std::min(headSize, range.size());
+
+            const std::size_t chunks{ (range.size() - headSize) / simd_batch<T>::size };
+            const std::size_t bodySize{ chunks * simd_batch<T>::size };
+
+            m_head = range.subspan(0, headSize);
+            m_body = range.subspan(headSize, bodySize);
+            m_tail = range.subspan(headSize + bodySize);
+
+            m_chunks = chunks_t{ std::views::iota(std::size_t{}, chunks), load_chunk{ m_body.data() } };
+        }
+
+        auto begin() const { return m_chunks.begin(); }
+        auto end() const { return m_chunks.end(); }
+        auto size() const { return m_chunks.size(); }
+
+        std::span<const T> head() const { return m_head; }
+        std::span<const T> body() const { return m_body; }
+        std::span<const T> tail() const { return m_tail; }
+    };
+
+    // =======================================================================
+    // algorithms: the same (generic) callable is used for batches and scalars
+
+    template <SimdArithmetic T, typename TFunc>
+    void simd_transform(std::span<const T> input, std::span<T> output, TFunc func)
+    {
+        chunk_simd_view<T> view{ input };
+
+        T* out{ output.data() };
+
+        out = std::ranges::transform(view.head(), out, func).out;
+
+        for (simd_batch<T> batch : view | std::views::transform(func)) {
+            batch.store(out);
+            out += simd_batch<T>::size;
+        }
+
+        std::ranges::transform(view.tail(), out, func);
+    }
+
+    template <SimdArithmetic T>
+    T simd_sum(std::span<const T> input)
+    {
+        chunk_simd_view<T> view{ input };
+
+        simd_batch<T> sum{ std::accumulate(view.begin(), view.end(), simd_batch<T>{}) };
+
+        return std::accumulate(view.head().begin(), view.head().end(), T{})
+            + sum.reduce()
+            + std::accumulate(view.tail().begin(), view.tail().end(), T{});
+    }
+
+    template <SimdArithmetic T, std::output_iterator<T> TOut>
+    TOut simd_copy_if_greater(std::span<const T> input, T threshold, TOut out)
+    {
+        chunk_simd_view<T> view{ input };
+
+        auto greater = [=](T value) { return value > threshold; };
+
+        out = std::ranges::copy_if(view.head(), out, greater).out;
+
+        const simd_batch<T> limit{ threshold };
+        const T* first{ view.body().data() };
+
+        for (simd_batch<T> batch : view) {
+            unsigned mask{ greater_mask(batch, limit) };
+            while (mask != 0) {
+                *out++ = first[std::countr_zero(mask)];
+                mask &= mask - 1;
+            }
+            first += simd_batch<T>::size;
+        }
+
+        return std::ranges::copy_if(view.tail(), out, greater).out;
+    }
+
+    // =======================================================================
+    // range adaptor object
+
+    namespace details
+    {
+        // chunk_simd_view refers to the elements of 'r' (std::span), it doesn't own them:
+        // temporaries (e.g. std::vector<int>{ ... } | views::chunk_simd) are rejected,
+        // otherwise the view would dangle
+        struct chunk_simd_range_adaptor
+        {
+            template <std::ranges::contiguous_range R>
+                requires std::ranges::borrowed_range<R> && std::ranges::sized_range<R> && SimdArithmetic<std::ranges::range_value_t<R>>
+            auto operator () (R&& r) const
+            {
+                using T = std::ranges::range_value_t<R>;
+                return chunk_simd_view<T>{ std::span<const T>{ std::ranges::data(r), std::ranges::size(r) } };
+            }
+        };
+
+        template <std::ranges::contiguous_range R>
+            requires std::ranges::borrowed_range<R>
+        auto operator | (R&& r, const chunk_simd_range_adaptor& a)
+        {
+            return a(std::forward<R>(r));
+        }
+    }
+}
+
+namespace views
+{
+    inline Cpp20RangesSimdChunks::details::chunk_simd_range_adaptor chunk_simd;
+}
+
+// ===========================================================================
+// ===========================================================================
+
+namespace Cpp20RangesSimdChunks
+{
+    auto square = [](auto v) { return v * v; };
+
+    static void simd_chunks_01_introduction()
+    {
+        auto numbers = std::vector{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+        // same as views2_introduction_02, but 4 squares per step
+        auto chunks = numbers | views::chunk_simd;
+        // auto dangling = std::vector{ 1, 2, 3 } | views::chunk_simd;   // error: no borrowed range
+
+        std::println("Head: {} elements, chunks: {}, tail: {} elements",
+            chunks.head().size(), chunks.size(), chunks.tail().size());
+
+        std::vector<int> squares(numbers.size());
+        simd_transform<int>(numbers, squares, square);
+
+        for (auto&& s : squares) {
+            std::print("{}, ", s);
+        }
+        std::println("");
+    }
+
+    static void simd_chunks_02_sum_and_filter()
+    {
+        auto numbers = std::vector{ 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5 };
+
+        std::println("Sum: {}", simd_sum<double>(numbers));
+
+        std::vector<double> large{};
+        simd_copy_if_greater<double>(numbers, 4.0, std::back_inserter(large));
+
+        for (auto&& value : large) {
+            std::print("{}, ", value);
+        }
+        std::println("");
+    }
+
+    // =======================================================================
+    // benchmark
+
+    template <typename TFunc>
+    static void measure(std::string_view label, TFunc func)
+    {
+        const auto [checksum, elapsed] { Helpers::stopwatch(func) };
+
+        const auto usecs{ std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() };
+
+        std::println("{:<36} {:>8} usecs (checksum {})", label, usecs, checksum);
+    }
+
+    template <SimdArithmetic T>
+    static void simd_chunks_benchmark(std::string_view type)
+    {
+        constexpr std::size_t Size{ 10'000'000 };
+
+        std::vector<T> numbers(Size);
+        for (std::size_t i{}; i != Size; ++i) {
+            numbers[i] = static_cast<T>(i % 100);
+        }
+
+        std::vector<T> result(Size);
+        const T threshold{ static_cast<T>(90) };
+
+        std::println("Workload: {} x {}", Size, type);
+
+        measure("  square   - transform view:", [&] {
+            std::ranges::copy(numbers | std::views::transform(square), result.begin());
+            return result.back();
+        });
+
+        measure("  square   - chunk_simd:", [&] {
+            simd_transform<T>(numbers, result, square);
+            return result.back();
+        });
+
+        measure("  sum      - std::accumulate:", [&] {
+            return std::accumulate(numbers.begin(), numbers.end(), T{});
+        });
+
+        measure("  sum      - chunk_simd:", [&] {
+            return simd_sum<T>(numbers);
+        });
+
+        measure("  filter   - filter view:", [&] {
+            auto last{ std::ranges::copy(numbers | std::views::filter([=](T v) { return v > threshold; }), result.begin()).out };
+            return last - result.begin();
+        });
+
+        measure("  filter   - chunk_simd:", [&] {
+            auto last{ simd_copy_if_greater<T>(numbers, threshold, result.begin()) };
+            return last - result.begin();
+        });
+    }
+
+    static void simd_chunks_03_benchmark()
+    {
+        simd_chunks_benchmark<int>("int");
+        simd_chunks_benchmark<float>("float");
+        simd_chunks_benchmark<double>("double");
+    }
+}
+
+void ranges_10_simd_chunk_view()
+{
+    using namespace Cpp20RangesSimdChunks;
+
+    simd_chunks_01_introduction();
+    simd_chunks_02_sum_and_filter();
+    simd_chunks_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
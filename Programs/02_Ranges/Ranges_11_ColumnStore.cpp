@@ -0,0 +1,288 @@
+// ===========================================================================
+// Ranges_11_ColumnStore.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesColumnStore
+{
+    // =======================================================================
+    // helpers for pointers to data members
+
+    template <typename T>
+    struct member_pointer_traits;
+
+    template <typename TClass, typename TMember>
+    struct member_pointer_traits<TMember TClass::*>
+    {
+        using class_type = TClass;
+        using member_type = TMember;
+    };
+
+    template <auto Member>
+    using member_type_t = typename member_pointer_traits<decltype(Member)>::member_type;
+
+    template <auto A, auto B>
+    constexpr bool same_member()
+    {
+        if constexpr (std::is_same_v<decltype(A), decltype(B)>) {
+            return A == B;
+        }
+        else {
+            return false;
+        }
+    }
+
+    // =======================================================================
+    // column_store: a "structure of arrays" container, each data member of
+    // TRecord (specified by a pointer to member) is stored in its own vector.
+    // A query touching only two integer members streams through two dense
+    // int columns instead of pulling whole records (std::string included)
+    // through the cache.
+
+    template <typename TRecord, auto... Members>
+        requires (std::same_as<typename member_pointer_traits<decltype(Members)>::class_type, TRecord> && ...)
+    class column_store
+    {
+    private:
+        std::tuple<std::vector<member_type_t<Members>>...> m_columns;
+
+        template <auto Member>
+        static constexpr std::size_t indexOf()
+        {
+            std::size_t index{};
+            const bool found{ ((same_member<Member, Members>() ? true : (++index, false)) || ...) };
+            return found ? index : sizeof...(Members);
+        }
+
+    public:
+        // row_ref: lightweight reference to one row of the store
+        class row_ref
+        {
+        private:
+            const column_store* m_store{};
+            std::size_t         m_index{};
+
+        public:
+            row_ref() = default;
+            row_ref(const column_store* store, std::size_t index) : m_store{ store }, m_index{ index } {}
+
+            template <auto Member>
+            const member_type_t<Member>& get() const
+            {
+                return m_store->template column<Member>()[m_index];
+            }
+
+            std::size_t index() const { return m_index; }
+
+            // copies all columns of this row into a record
+            TRecord materialize() const
+            {
+                TRecord record{};
+                ((record.*Members = get<Members>()), ...);
+                return record;
+            }
+        };
+
+        column_store() = default;
+
+        template <std::ranges::input_range TRange>
+            requires std::same_as<std::ranges::range_value_t<TRange>, TRecord>
+        explicit column_store(TRange&& records)
+        {
+            if constexpr (std::ranges::sized_range<TRange>) {
+                reserve(std::ranges::size(records));
+            }
+
+            for (const TRecord& record : records) {
+                push_back(record);
+            }
+        }
+
+        void reserve(std::size_t count)
+        {
+            std::apply([=](auto&... column) { (column.reserve(count), ...); }, m_columns);
+        }
+
+        void push_back(const TRecord& record)
+        {
+            pushBack(record, std::index_sequence_for<decltype(Members)...>{});
+        }
+
+        std::size_t size() const { return std::get<0>(m_columns).size(); }
+
+        // dense, contiguous access to a single column
+        template <auto Member>
+            requires (indexOf<Member>() < sizeof...(Members))
+        std::span<const member_type_t<Member>> column() const
+        {
+            return std::get<indexOf<Member>()>(m_columns);
+        }
+
+        template <auto Member>
+            requires (indexOf<Member>() < sizeof...(Members))
+        std::span<member_type_t<Member>> column()
+        {
+            return std::get<indexOf<Member>()>(m_columns);
+        }
+
+        // all rows as a random access range of row_ref objects
+        auto rows() const
+        {
+            return std::views::iota(std::size_t{}, size())
+                | std::views::transform([this](std::size_t index) { return row_ref{ this, index }; });
+        }
+
+    private:
+        template <std::size_t... Indices>
+        void pushBack(const TRecord& record, std::index_sequence<Indices...>)
+        {
+            (std::get<Indices>(m_columns).push_back(record.*Members), ...);
+        }
+    };
+
+    // =======================================================================
+    // col<&Record::member>: projection usable for records (array of structs)
+    // and for rows of a column_store (structure of arrays) alike
+
+    template <auto Member>
+    struct column_projection
+    {
+        template <typename TRow>
+        decltype(auto) operator() (const TRow& row) const
+        {
+            if constexpr (std::is_invocable_v<decltype(Member), const TRow&>) {
+                return std::invoke(Member, row);
+            }
+            else {
+                return row.template get<Member>();
+            }
+        }
+    };
+
+    template <auto Member>
+    inline constexpr column_projection<Member> col{};
+
+    // =======================================================================
+    // examples
+
+    struct Student {
+        std::string m_name{};
+        int m_year{};
+        int m_score{};
+    };
+
+    using StudentStore = column_store<Student, &Student::m_name, &Student::m_year, &Student::m_score>;
+
+    // the same query works for std::vector<Student> and for StudentStore
+    static int getMaxScore(const auto& students, int year)
+    {
+        auto scores = students
+            | std::views::filter([=](const auto& s) { return col<&Student::m_year>(s) == year; })
+            | std::views::transform(col<&Student::m_score>);
+
+        const auto it = std::ranges::max_element(scores);
+        return it != scores.end() ? *it : -1;
+    }
+
+    // streams only through two dense int columns
+    static int getMaxScoreColumns(const StudentStore& students, int year)
+    {
+        const auto years{ students.column<&Student::m_year>() };
+        const auto scores{ students.column<&Student::m_score>() };
+
+        int maxScore{ -1 };
+        for (std::size_t i{}; i != years.size(); ++i) {
+            const int candidate{ years[i] == year ? scores[i] : -1 };
+            maxScore = std::max(maxScore, candidate);
+        }
+
+        return maxScore;
+    }
+
+    static int getMaxScoreRecords(const std::vector<Student>& students, int year)
+    {
+        int maxScore{ -1 };
+        for (const auto& student : students) {
+            const int candidate{ student.m_year == year ? student.m_score : -1 };
+            maxScore = std::max(maxScore, candidate);
+        }
+
+        return maxScore;
+    }
+
+    static void column_store_01_introduction()
+    {
+        auto students = std::vector<Student>
+        {
+            {"Georg", 2021, 120 },
+            {"Hans",  2021, 140 },
+            {"Susan", 2020, 180 },
+            {"Mike",  2020, 110 },
+            {"Hello", 2021, 190 },
+            {"Franz", 2021, 110 },
+        };
+
+        StudentStore store{ students };
+
+        std::println("Rows: {}", store.size());
+        std::println("Max Score (2021, AoS): {}", getMaxScore(students, 2021));
+        std::println("Max Score (2021, SoA): {}", getMaxScore(store.rows(), 2021));
+        std::println("Max Score (2020, SoA): {}", getMaxScoreColumns(store, 2020));
+
+        // projections on rows
+        auto rows{ store.rows() };
+        auto best{ *std::ranges::max_element(rows, {}, col<&Student::m_score>) };
+        Student student{ best.materialize() };
+        std::println("Best student: {} ({}, {})", student.m_name, student.m_year, student.m_score);
+
+        for (const std::string& name : store.column<&Student::m_name>()) {
+            std::print("{} ", name);
+        }
+        std::println("");
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    static void column_store_02_benchmark()
+    {
+        constexpr std::size_t Rows{ 10'000'000 };
+        constexpr int Year{ 2021 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> years{ 2000, 2024 };
+        std::uniform_int_distribution<int> scores{ 0, 1'000'000 };
+
+        std::vector<Student> students{};
+        students.reserve(Rows);
+        for (std::size_t i{}; i != Rows; ++i) {
+            students.push_back({ std::format("Student {}", i % 1000), years(generator), scores(generator) });
+        }
+
+        StudentStore store{ students };
+
+        std::println("{} rows, sizeof(Student) = {}", Rows, sizeof(Student));
+
+        measure("AoS - filter | transform:", [&] { return getMaxScore(students, Year); });
+        measure("SoA - filter | transform:", [&] { return getMaxScore(store.rows(), Year); });
+        measure("AoS - loop:", [&] { return getMaxScoreRecords(students, Year); });
+        measure("SoA - loop over two columns:", [&] { return getMaxScoreColumns(store, Year); });
+    }
+}
+
+void ranges_11_column_store()
+{
+    using namespace Cpp20RangesColumnStore;
+
+    column_store_01_introduction();
+    column_store_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,340 @@
+// ===========================================================================
+// Ranges_12_GroupByAggregate.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesGroupByAggregate
+{
+    // =======================================================================
+    // aggregate functions: each one describes
+    //   * the state of a partial result (state_type),
+    //   * how an element is added to a state (add),
+    //   * how two partial states are merged (merge) and
+    //   * how the final value is computed (result)
+
+    namespace agg
+    {
+        template <typename TProj>
+        struct Max
+        {
+            TProj m_proj;
+
+            template <typename TElem>
+            using state_type = std::optional<std::remove_cvref_t<std::invoke_result_t<const TProj&, const TElem&>>>;
+
+            template <typename TState, typename TElem>
+            void add(TState& state, const TElem& elem) const
+            {
+                auto value{ std::invoke(m_proj, elem) };
+                if (!state || *state < value) {
+                    state = value;
+                }
+            }
+
+            template <typename TState>
+            void merge(TState& state, const TState& other) const
+            {
+                if (other && (!state || *state < *other)) {
+                    state = other;
+                }
+            }
+
+            template <typename TState>
+            auto result(const TState& state) const { return *state; }   // groups are never empty
+        };
+
+        template <typename TProj>
+        struct Min
+        {
+            TProj m_proj;
+
+            template <typename TElem>
+            using state_type = std::optional<std::remove_cvref_t<std::invoke_result_t<const TProj&, const TElem&>>>;
+
+            template <typename TState, typename TElem>
+            void add(TState& state, const TElem& elem) const
+            {
+                auto value{ std::invoke(m_proj, elem) };
+                if (!state || value < *state) {
+                    state = value;
+                }
+            }
+
+            template <typename TState>
+            void merge(TState& state, const TState& other) const
+            {
+                if (other && (!state || *other < *state)) {
+                    state = other;
+                }
+            }
+
+            template <typename TState>
+            auto result(const TState& state) const { return *state; }
+        };
+
+        template <typename TProj>
+        struct Sum
+        {
+            TProj m_proj;
+
+            // integral values are summed up with 64 bits
+            template <typename TElem>
+            using state_type = std::conditional_t<
+                std::integral<std::remove_cvref_t<std::invoke_result_t<const TProj&, const TElem&>>>,
+                long long,
+                std::remove_cvref_t<std::invoke_result_t<const TProj&, const TElem&>>
+            >;
+
+            template <typename TState, typename TElem>
+            void add(TState& state, const TElem& elem) const { state += std::invoke(m_proj, elem); }
+
+            template <typename TState>
+            void merge(TState& state, const TState& other) const { state += other; }
+
+            template <typename TState>
+            auto result(const TState& state) const { return state; }
+        };
+
+        struct Count
+        {
+            template <typename TElem>
+            using state_type = std::size_t;
+
+            template <typename TElem>
+            void add(std::size_t& state, const TElem&) const { ++state; }
+
+            void merge(std::size_t& state, std::size_t other) const { state += other; }
+
+            std::size_t result(std::size_t state) const { return state; }
+        };
+
+        template <typename TProj> auto max(TProj proj) { return Max<TProj>{ proj }; }
+        template <typename TProj> auto min(TProj proj) { return Min<TProj>{ proj }; }
+        template <typename TProj> auto sum(TProj proj) { return Sum<TProj>{ proj }; }
+        inline auto count() { return Count{}; }
+    }
+
+    // =======================================================================
+    // range | group_by(key) | aggregate(agg::max(...), agg::count(), ...)
+    //
+    // single pass over the range: every thread builds a partial hash table
+    // for its part of the range, the partial tables are merged at the end.
+    // The result is a dense table (std::vector of std::tuple objects)
+    // sorted by the key: { key, result_1, result_2, ... }
+
+    template <typename TKeyProj>
+    struct group_by_closure
+    {
+        TKeyProj    m_key;
+        std::size_t m_threads;
+    };
+
+    // threads == 0: use all hardware threads
+    template <typename TKeyProj>
+    auto group_by(TKeyProj key, std::size_t threads = 0)
+    {
+        return group_by_closure<TKeyProj>{ key, threads };
+    }
+
+    template <std::ranges::view V, typename TKeyProj>
+    struct grouping
+    {
+        V           m_range;
+        TKeyProj    m_key;
+        std::size_t m_threads;
+    };
+
+    template <std::ranges::viewable_range R, typename TKeyProj>
+        requires std::ranges::random_access_range<R> && std::ranges::sized_range<R>
+    auto operator| (R&& range, const group_by_closure<TKeyProj>& closure)
+    {
+        return grouping<std::views::all_t<R>, TKeyProj>{
+            std::views::all(std::forward<R>(range)), closure.m_key, closure.m_threads
+        };
+    }
+
+    template <typename... TAggs>
+    struct aggregate_closure
+    {
+        std::tuple<TAggs...> m_aggs;
+    };
+
+    template <typename... TAggs>
+    auto aggregate(TAggs... aggs)
+    {
+        return aggregate_closure<TAggs...>{ { aggs... } };
+    }
+
+    template <typename V, typename TKeyProj, typename... TAggs, std::size_t... Indices>
+    auto execute(const grouping<V, TKeyProj>& grouping, const std::tuple<TAggs...>& aggs, std::index_sequence<Indices...>)
+    {
+        using Elem = std::ranges::range_value_t<V>;
+        using Key = std::remove_cvref_t<std::invoke_result_t<const TKeyProj&, std::ranges::range_reference_t<V>>>;
+        using States = std::tuple<typename TAggs::template state_type<Elem>...>;
+        using Table = std::unordered_map<Key, States>;
+
+        const auto first{ std::ranges::begin(grouping.m_range) };
+        const auto size{ static_cast<std::size_t>(std::ranges::size(grouping.m_range)) };
+
+        const std::size_t threads{ Helpers::numberOfThreads(size, grouping.m_threads) };
+
+        std::vector<Table> partials(threads);
+
+        Helpers::parallelFor(threads, [&](std::size_t index) {
+            const auto begin{ first + static_cast<std::ptrdiff_t>(size * index / threads) };
+            const auto end{ first + static_cast<std::ptrdiff_t>(size * (index + 1) / threads) };
+
+            Table& table{ partials[index] };
+
+            for (auto it{ begin }; it != end; ++it) {
+                const Elem& elem{ *it };
+                States& states{ table[std::invoke(grouping.m_key, elem)] };
+                (std::get<Indices>(aggs).add(std::get<Indices>(states), elem), ...);
+            }
+        });
+
+        // merge partial tables
+        Table& table{ partials.front() };
+        for (std::size_t index{ 1 }; index < threads; ++index) {
+            for (const auto& [key, other] : partials[index]) {
+                auto [pos, inserted] { table.try_emplace(key, other) };
+                if (!inserted) {
+                    (std::get<Indices>(aggs).merge(std::get<Indices>(pos->second), std::get<Indices>(other)), ...);
+                }
+            }
+        }
+
+        // dense result table, sorted by key
+        using Row = std::tuple<Key, decltype(std::get<Indices>(aggs).result(std::declval<const std::tuple_element_t<Indices, States>&>()))...>;
+
+        std::vector<Row> result{};
+        result.reserve(table.size());
+
+        for (const auto& [key, states] : table) {
+            result.emplace_back(key, std::get<Indices>(aggs).result(std::get<Indices>(states))...);
+        }
+
+        std::ranges::sort(result, {}, [](const Row& row) -> const Key& { return std::get<0>(row); });
+
+        return result;
+    }
+
+    template <typename V, typename TKeyProj, typename... TAggs>
+    auto operator| (const grouping<V, TKeyProj>& grouping, const aggregate_closure<TAggs...>& closure)
+    {
+        return execute(grouping, closure.m_aggs, std::index_sequence_for<TAggs...>{});
+    }
+
+    // =======================================================================
+    // examples
+
+    struct Student {
+        std::string m_name{};
+        int m_year{};
+        int m_score{};
+    };
+
+    static void group_by_01_introduction()
+    {
+        auto students = std::vector<Student>
+        {
+            {"Georg", 2021, 120 },
+            {"Hans",  2021, 140 },
+            {"Susan", 2020, 180 },
+            {"Mike",  2020, 110 },
+            {"Hello", 2021, 190 },
+            {"Franz", 2021, 110 },
+        };
+
+        // the maximum score of every year in one pass
+        auto table = students
+            | group_by(&Student::m_year)
+            | aggregate(agg::max(&Student::m_score), agg::min(&Student::m_score), agg::sum(&Student::m_score), agg::count());
+
+        for (const auto& [year, maxScore, minScore, sum, count] : table) {
+            std::println("{}: max = {}, min = {}, sum = {}, count = {}", year, maxScore, minScore, sum, count);
+        }
+
+        // any projection can be used as key
+        auto byInitial = students
+            | group_by([](const Student& s) { return s.m_name.front(); })
+            | aggregate(agg::count());
+
+        for (const auto& [initial, count] : byInitial) {
+            std::print("{}: {}  ", initial, count);
+        }
+        std::println("");
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    struct Score {
+        int m_year{};
+        int m_score{};
+    };
+
+    static void group_by_02_benchmark()
+    {
+        constexpr std::size_t Records{ 100'000'000 };
+        constexpr int FirstYear{ 2000 };
+        constexpr int LastYear{ 2024 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> years{ FirstYear, LastYear };
+        std::uniform_int_distribution<int> scores{ 0, 1'000'000 };
+
+        std::vector<Score> records(Records);
+        for (auto& record : records) {
+            record = { years(generator), scores(generator) };
+        }
+
+        std::println("{} records, {} threads", Records, std::thread::hardware_concurrency());
+
+        measure("one filter | transform | max per year:", [&] {
+            long long checksum{};
+            for (int year{ FirstYear }; year <= LastYear; ++year) {
+                auto scores = records
+                    | std::views::filter([=](const Score& s) { return s.m_year == year; })
+                    | std::views::transform(&Score::m_score);
+                checksum += *std::ranges::max_element(scores);
+            }
+            return checksum;
+        });
+
+        measure("group_by | aggregate (1 thread):", [&] {
+            auto table = records | group_by(&Score::m_year, 1) | aggregate(agg::max(&Score::m_score));
+            long long checksum{};
+            for (const auto& [year, maxScore] : table) {
+                checksum += maxScore;
+            }
+            return checksum;
+        });
+
+        measure("group_by | aggregate (all threads):", [&] {
+            auto table = records | group_by(&Score::m_year) | aggregate(agg::max(&Score::m_score));
+            long long checksum{};
+            for (const auto& [year, maxScore] : table) {
+                checksum += maxScore;
+            }
+            return checksum;
+        });
+    }
+}
+
+void ranges_12_group_by_aggregate()
+{
+    using namespace Cpp20RangesGroupByAggregate;
+
+    group_by_01_introduction();
+    group_by_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
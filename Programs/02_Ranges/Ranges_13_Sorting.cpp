@@ -0,0 +1,1399 @@
+// ===========================================================================
+// Ranges_13_Sorting.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesSorting
+{
+    // =======================================================================
+    // helpers
+
+    using Helpers::parallelFor;
+    using Helpers::numberOfThreads;
+
+    // reorders range according to indices: range[i] = old range[indices[i]].
+    // The elements are gathered into a buffer and moved back: the reads are
+    // independent of each other, following the cycles of the permutation in
+    // place would produce one dependent cache miss per element
+    template <std::ranges::random_access_range TRange, typename TIndex>
+    void applyPermutation(TRange&& range, std::span<const TIndex> indices)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        const auto first{ std::ranges::begin(range) };
+
+        std::vector<ValueType> buffer{};
+        buffer.reserve(indices.size());
+
+        for (const TIndex index : indices) {
+            buffer.push_back(std::ranges::iter_move(first + index));
+        }
+
+        std::ranges::move(buffer, first);
+    }
+
+    // reorders range in place by following the cycles of the permutation:
+    // no buffer for the elements is needed (indices is modified)
+    template <std::ranges::random_access_range TRange, typename TIndex>
+    void applyPermutationInPlace(TRange&& range, std::span<TIndex> indices)
+    {
+        const auto first{ std::ranges::begin(range) };
+
+        for (std::size_t i{}; i != indices.size(); ++i) {
+
+            if (indices[i] == i) {
+                continue;
+            }
+
+            auto tmp{ std::ranges::iter_move(first + i) };
+            std::size_t current{ i };
+
+            while (indices[current] != i) {
+                const std::size_t next{ indices[current] };
+                first[current] = std::ranges::iter_move(first + next);
+                indices[current] = static_cast<TIndex>(current);
+                current = next;
+            }
+
+            first[current] = std::move(tmp);
+            indices[current] = static_cast<TIndex>(current);
+        }
+    }
+
+    // =======================================================================
+    // radix_sort: LSD radix sort for integral and floating-point keys
+    //
+    // * the projection is invoked exactly once per element,
+    // * keys are mapped to unsigned integers preserving their order,
+    // * (key, index) pairs are sorted with 8-bit digits, passes with only one
+    //   occupied bucket are skipped,
+    // * finally the elements are moved to their new positions.
+    //
+    // Like every LSD radix sort the algorithm is stable.
+
+    template <typename T>
+    concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+    template <typename TComp>
+    concept RadixComparator =
+        std::same_as<TComp, std::ranges::less> || std::same_as<TComp, std::less<>> ||
+        std::same_as<TComp, std::ranges::greater> || std::same_as<TComp, std::greater<>>;
+
+    namespace details
+    {
+        template <typename TKey>
+        using unsigned_key_t = std::conditional_t<sizeof(TKey) <= 4, std::uint32_t, std::uint64_t>;
+
+        // order preserving mapping of a key to an unsigned integer
+        template <RadixKey TKey>
+        constexpr auto toUnsigned(TKey key)
+        {
+            using UKey = unsigned_key_t<TKey>;
+
+            if constexpr (std::floating_point<TKey>) {
+                static_assert(sizeof(TKey) == 4 || sizeof(TKey) == 8);
+                using Bits = std::conditional_t<sizeof(TKey) == 4, std::uint32_t, std::uint64_t>;
+                constexpr Bits SignBit{ Bits{ 1 } << (sizeof(Bits) * 8 - 1) };
+
+                const Bits bits{ std::bit_cast<Bits>(key) };
+                return static_cast<UKey>((bits & SignBit) ? ~bits : (bits | SignBit));
+            }
+            else if constexpr (std::signed_integral<TKey>) {
+                constexpr UKey SignBit{ UKey{ 1 } << (sizeof(TKey) * 8 - 1) };
+                using UTKey = std::make_unsigned_t<TKey>;
+                const UKey bits{ static_cast<UKey>(static_cast<UTKey>(key)) };
+                return static_cast<UKey>(bits ^ SignBit);
+            }
+            else {
+                return static_cast<UKey>(key);
+            }
+        }
+
+        template <typename UKey, typename TIndex>
+        struct Entry
+        {
+            UKey   m_key;
+            TIndex m_index;
+        };
+
+        template <typename UKey, typename TIndex>
+        void radixSortEntries(std::vector<Entry<UKey, TIndex>>& entries, std::size_t keyBytes, std::size_t threads)
+        {
+            constexpr std::size_t Buckets{ 256 };
+
+            using Histogram = std::array<std::size_t, Buckets>;
+
+            const std::size_t size{ entries.size() };
+            std::vector<Entry<UKey, TIndex>> buffer(size);
+            std::vector<Histogram> histograms(threads);
+
+            auto chunkBegin = [&](std::size_t index) { return size * index / threads; };
+
+            for (std::size_t pass{}; pass != keyBytes; ++pass) {
+
+                const unsigned shift{ static_cast<unsigned>(pass * 8) };
+
+                parallelFor(threads, [&](std::size_t index) {
+                    Histogram& histogram{ histograms[index] };
+                    histogram.fill(0);
+                    for (std::size_t i{ chunkBegin(index) }; i != chunkBegin(index + 1); ++i) {
+                        ++histogram[(entries[i].m_key >> shift) & 0xFF];
+                    }
+                });
+
+                // exclusive prefix sums: digit major, thread minor
+                std::size_t offset{};
+                bool trivial{ false };
+                for (std::size_t digit{}; digit != Buckets; ++digit) {
+                    const std::size_t start{ offset };
+                    for (Histogram& histogram : histograms) {
+                        const std::size_t count{ histogram[digit] };
+                        histogram[digit] = offset;
+                        offset += count;
+                    }
+                    trivial = trivial || (offset - start == size);
+                }
+
+                if (trivial) {
+                    continue;   // all keys have the same digit
+                }
+
+                parallelFor(threads, [&](std::size_t index) {
+                    Histogram& histogram{ histograms[index] };
+                    for (std::size_t i{ chunkBegin(index) }; i != chunkBegin(index + 1); ++i) {
+                        const auto& entry{ entries[i] };
+                        buffer[histogram[(entry.m_key >> shift) & 0xFF]++] = entry;
+                    }
+                });
+
+                entries.swap(buffer);
+            }
+        }
+
+        template <typename TIndex, typename TRange, typename TComp, typename TProj>
+        void radixSort(TRange&& range, TComp, TProj proj, std::size_t threads)
+        {
+            using Key = std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>>;
+            using UKey = unsigned_key_t<Key>;
+            using EntryType = Entry<UKey, TIndex>;
+
+            constexpr bool Descending{
+                std::same_as<TComp, std::ranges::greater> || std::same_as<TComp, std::greater<>>
+            };
+
+            const auto first{ std::ranges::begin(range) };
+            const std::size_t size{ static_cast<std::size_t>(std::ranges::size(range)) };
+
+            // extract every key exactly once
+            std::vector<EntryType> entries(size);
+            parallelFor(threads, [&](std::size_t index) {
+                for (std::size_t i{ size * index / threads }; i != size * (index + 1) / threads; ++i) {
+                    const UKey key{ toUnsigned(static_cast<Key>(std::invoke(proj, first[i]))) };
+                    entries[i] = EntryType{ Descending ? static_cast<UKey>(~key) : key, static_cast<TIndex>(i) };
+                }
+            });
+
+            radixSortEntries(entries, sizeof(Key), threads);
+
+            std::vector<TIndex> indices(size);
+            for (std::size_t i{}; i != size; ++i) {
+                indices[i] = entries[i].m_index;
+            }
+            entries = {};
+
+            applyPermutation(range, std::span<const TIndex>{ indices });
+        }
+
+        template <typename TRange, typename TComp, typename TProj>
+        void radixSortDispatch(TRange&& range, TComp comp, TProj proj, std::size_t threads)
+        {
+            const auto size{ static_cast<std::size_t>(std::ranges::size(range)) };
+
+            if (size < 2) {
+                return;
+            }
+
+            // 32-bit indices halve the size of the (key, index) buffer
+            if (size <= std::numeric_limits<std::uint32_t>::max()) {
+                radixSort<std::uint32_t>(range, comp, proj, threads);
+            }
+            else {
+                radixSort<std::size_t>(range, comp, proj, threads);
+            }
+        }
+    }
+
+    template <std::ranges::random_access_range TRange,
+        RadixComparator TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            RadixKey<std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>>> &&
+            std::permutable<std::ranges::iterator_t<TRange>>
+    void radix_sort(TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        details::radixSortDispatch(range, comp, proj, 1);
+    }
+
+    template <std::ranges::random_access_range TRange,
+        RadixComparator TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            RadixKey<std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>>> &&
+            std::permutable<std::ranges::iterator_t<TRange>>
+    void radix_sort(const std::execution::parallel_policy&, TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        details::radixSortDispatch(range, comp, proj, numberOfThreads(std::ranges::size(range)));
+    }
+
+    // =======================================================================
+    // key_sort: sorting with key extraction ("Schwartzian transform")
+    //
+    // The projection is invoked exactly once per element, the (key, index)
+    // pairs are sorted and the permutation is applied to the range in place.
+    // Equal keys are ordered by their index: the sort is stable.
+    //
+    // String keys are represented by an 8-byte prefix (big-endian, integer
+    // comparison equals lexicographic comparison) and the index, the complete
+    // key is only consulted when two prefixes are equal.
+
+    namespace details
+    {
+        // std::string and std::string_view only: their operator< is the
+        // lexicographic comparison of the characters as unsigned char.
+        // Other types convertible to std::string_view (const char*, ...)
+        // are compared by their own operator< and take the generic path
+        template <typename TKey>
+        constexpr bool IsStringKey{ false };
+
+        template <typename TAlloc>
+        constexpr bool IsStringKey<std::basic_string<char, std::char_traits<char>, TAlloc>>{ true };
+
+        template <>
+        constexpr bool IsStringKey<std::string_view>{ true };
+
+        template <typename TKey>
+        concept StringKey = IsStringKey<TKey>;
+
+        static_assert(StringKey<std::string> && StringKey<std::string_view>);
+        static_assert(!StringKey<const char*> && !StringKey<char*>);
+
+        inline std::uint64_t stringPrefix(std::string_view s)
+        {
+            std::array<unsigned char, 8> bytes{};
+            std::memcpy(bytes.data(), s.data(), std::min(s.size(), bytes.size()));
+
+            const std::uint64_t prefix{ std::bit_cast<std::uint64_t>(bytes) };
+            if constexpr (std::endian::native == std::endian::little) {
+                return std::byteswap(prefix);
+            }
+            else {
+                return prefix;
+            }
+        }
+
+        template <typename TIndex, typename TRange, typename TComp, typename TProj>
+        void keySortStrings(TRange&& range, TComp, TProj proj, std::span<TIndex> indices)
+        {
+            using Result = std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>;
+
+            constexpr bool Descending{
+                std::same_as<TComp, std::ranges::greater> || std::same_as<TComp, std::greater<>>
+            };
+
+            // keys returned by value are stored, otherwise they are owned by the elements
+            using Storage = std::conditional_t<std::is_lvalue_reference_v<Result>, std::string_view, std::remove_cvref_t<Result>>;
+
+            struct PrefixEntry
+            {
+                std::uint64_t m_prefix;
+                TIndex        m_index;
+            };
+
+            const auto first{ std::ranges::begin(range) };
+
+            std::vector<Storage> keys{};
+            keys.reserve(indices.size());
+
+            std::vector<PrefixEntry> entries(indices.size());
+
+            for (std::size_t i{}; i != indices.size(); ++i) {
+                keys.push_back(std::invoke(proj, first[i]));
+                entries[i] = PrefixEntry{ stringPrefix(keys.back()), static_cast<TIndex>(i) };
+            }
+
+            std::ranges::sort(entries, [&](const PrefixEntry& a, const PrefixEntry& b) {
+                if (a.m_prefix != b.m_prefix) {
+                    return Descending ? a.m_prefix > b.m_prefix : a.m_prefix < b.m_prefix;
+                }
+
+                const int result{ std::string_view{ keys[a.m_index] }.compare(std::string_view{ keys[b.m_index] }) };
+                if (result != 0) {
+                    return Descending ? result > 0 : result < 0;
+                }
+
+                return a.m_index < b.m_index;
+            });
+
+            for (std::size_t i{}; i != indices.size(); ++i) {
+                indices[i] = entries[i].m_index;
+            }
+        }
+
+        template <typename TIndex, typename TRange, typename TComp, typename TProj>
+        void keySortGeneric(TRange&& range, TComp comp, TProj proj, std::span<TIndex> indices)
+        {
+            using Key = std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>>;
+
+            struct KeyEntry
+            {
+                Key    m_key;
+                TIndex m_index;
+            };
+
+            const auto first{ std::ranges::begin(range) };
+
+            std::vector<KeyEntry> entries{};
+            entries.reserve(indices.size());
+
+            for (std::size_t i{}; i != indices.size(); ++i) {
+                entries.push_back(KeyEntry{ std::invoke(proj, first[i]), static_cast<TIndex>(i) });
+            }
+
+            std::ranges::sort(entries, [&](const KeyEntry& a, const KeyEntry& b) {
+                if (std::invoke(comp, a.m_key, b.m_key)) {
+                    return true;
+                }
+                if (std::invoke(comp, b.m_key, a.m_key)) {
+                    return false;
+                }
+                return a.m_index < b.m_index;
+            });
+
+            for (std::size_t i{}; i != indices.size(); ++i) {
+                indices[i] = entries[i].m_index;
+            }
+        }
+
+        template <typename TIndex, typename TRange, typename TComp, typename TProj>
+        void keySort(TRange&& range, TComp comp, TProj proj)
+        {
+            using Key = std::remove_cvref_t<std::invoke_result_t<TProj&, std::ranges::range_reference_t<TRange>>>;
+
+            std::vector<TIndex> indices(static_cast<std::size_t>(std::ranges::size(range)));
+
+            if constexpr (StringKey<Key> && RadixComparator<TComp>) {
+                keySortStrings(range, comp, proj, std::span<TIndex>{ indices });
+            }
+            else {
+                keySortGeneric(range, comp, proj, std::span<TIndex>{ indices });
+            }
+
+            applyPermutationInPlace(range, std::span<TIndex>{ indices });
+        }
+    }
+
+    template <std::ranges::random_access_range TRange,
+        typename TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            std::sortable<std::ranges::iterator_t<TRange>, TComp, TProj>
+    void key_sort(TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        const auto size{ static_cast<std::size_t>(std::ranges::size(range)) };
+
+        if (size < 2) {
+            return;
+        }
+
+        if (size <= std::numeric_limits<std::uint32_t>::max()) {
+            details::keySort<std::uint32_t>(range, comp, proj);
+        }
+        else {
+            details::keySort<std::size_t>(range, comp, proj);
+        }
+    }
+
+    // =======================================================================
+    // parallel sorting of random access ranges (comparators and projections
+    // as with std::ranges::sort, sub-views like views::take are supported)
+    //
+    // parallel_sort:          sample sort, O(n) additional memory
+    // parallel_stable_sort:   blocks are sorted stable, then merged pairwise,
+    //                         each merge is split among the threads (co-ranks)
+    // parallel_sort_in_place: quicksort with parallel partitioning,
+    //                         O(log n + p) additional memory
+    //
+    // The work is distributed on a work-stealing thread pool, the number of
+    // threads is limited by std::thread::hardware_concurrency(). An exception
+    // thrown by the comparator or the projection is rethrown on the calling
+    // thread, the range holds valid but unspecified values then (as with
+    // std::ranges::sort).
+
+    namespace details
+    {
+        // -------------------------------------------------------------------
+        // work-stealing thread pool
+        //
+        // Every worker owns a deque of tasks: it takes tasks from the back of
+        // its own deque (the most recently forked, cache-warm piece of work)
+        // and steals from the front of the other deques (the oldest and
+        // usually biggest pieces) when its own deque is empty. A thread
+        // waiting for a task_group runs queued tasks in the meantime: nested
+        // fork-join (quicksort) neither deadlocks nor blocks a worker.
+
+        class work_stealing_pool
+        {
+        private:
+            struct queue
+            {
+                std::mutex                        m_mutex{};
+                std::deque<std::function<void()>> m_tasks{};
+            };
+
+            std::vector<queue>          m_queues;
+            std::atomic<std::size_t>    m_queued{};
+            std::atomic<std::size_t>    m_next{};
+            std::mutex                  m_mutex{};
+            std::condition_variable_any m_wakeup{};
+            std::vector<std::jthread>   m_workers{};    // last member: joined first
+
+            static inline thread_local const work_stealing_pool* t_pool{};
+            static inline thread_local std::size_t               t_index{};
+
+        public:
+            // the calling thread takes part in the work: workers + 1 threads
+            explicit work_stealing_pool(std::size_t workers)
+                : m_queues(std::max<std::size_t>(workers, 1))
+            {
+                m_workers.reserve(workers);
+                for (std::size_t index{}; index != workers; ++index) {
+                    m_workers.emplace_back([this, index](std::stop_token token) { work(token, index); });
+                }
+            }
+
+            work_stealing_pool(const work_stealing_pool&) = delete;
+            work_stealing_pool& operator= (const work_stealing_pool&) = delete;
+
+            static work_stealing_pool& instance()
+            {
+                static work_stealing_pool pool{ std::max<std::size_t>(1, std::thread::hardware_concurrency()) - 1 };
+                return pool;
+            }
+
+            // workers push to their own deque, other threads round robin
+            void push(std::function<void()> task)
+            {
+                const std::size_t index{ t_pool == this ? t_index : m_next++ % m_queues.size() };
+                {
+                    std::lock_guard lock{ m_queues[index].m_mutex };
+                    m_queues[index].m_tasks.push_back(std::move(task));
+                }
+                m_queued.fetch_add(1);
+
+                // a worker between checking m_queued and waiting can't miss the notification
+                { std::lock_guard lock{ m_mutex }; }
+                m_wakeup.notify_one();
+            }
+
+            // runs one queued task - false, if there is none
+            bool tryRunOne()
+            {
+                if (m_queued.load() == 0) {
+                    return false;
+                }
+
+                const bool worker{ t_pool == this };
+                const std::size_t self{ worker ? t_index : 0 };
+
+                std::function<void()> task{};
+
+                for (std::size_t i{}; i != m_queues.size() && !task; ++i) {
+                    queue& q{ m_queues[(self + i) % m_queues.size()] };
+                    std::lock_guard lock{ q.m_mutex };
+
+                    if (q.m_tasks.empty()) {
+                        continue;
+                    }
+
+                    if (i == 0 && worker) {
+                        task = std::move(q.m_tasks.back());
+                        q.m_tasks.pop_back();
+                    }
+                    else {
+                        task = std::move(q.m_tasks.front());
+                        q.m_tasks.pop_front();
+                    }
+                }
+
+                if (!task) {
+                    return false;
+                }
+
+                m_queued.fetch_sub(1);
+                task();
+                return true;
+            }
+
+        private:
+            void work(std::stop_token token, std::size_t index)
+            {
+                t_pool = this;
+                t_index = index;
+
+                while (!token.stop_requested()) {
+                    if (!tryRunOne()) {
+                        std::unique_lock lock{ m_mutex };
+                        m_wakeup.wait(lock, token, [this] { return m_queued.load() != 0; });
+                    }
+                }
+            }
+        };
+
+        // tasks forked on the pool; wait() returns when all of them are done
+        // and rethrows the first exception thrown by one of them
+        class task_group
+        {
+        private:
+            work_stealing_pool&      m_pool;
+            std::atomic<std::size_t> m_pending{};
+            std::mutex               m_mutex{};
+            std::exception_ptr       m_error{};
+
+        public:
+            explicit task_group(work_stealing_pool& pool = work_stealing_pool::instance())
+                : m_pool{ pool }
+            {}
+
+            task_group(const task_group&) = delete;
+            task_group& operator= (const task_group&) = delete;
+
+            // the tasks refer to objects of the forking function
+            ~task_group() { join(); }
+
+            template <typename TFunc>
+            void run(TFunc func)
+            {
+                m_pending.fetch_add(1);
+
+                try {
+                    m_pool.push([this, func = std::move(func)]() mutable {
+                        invoke(func);
+                        m_pending.fetch_sub(1, std::memory_order_release);
+                    });
+                }
+                catch (...) {
+                    m_pending.fetch_sub(1);
+                    throw;
+                }
+            }
+
+            // runs func on the calling thread, then waits
+            template <typename TFunc>
+            void run_and_wait(TFunc func)
+            {
+                invoke(func);
+                wait();
+            }
+
+            void wait()
+            {
+                join();
+
+                if (m_error) {
+                    std::rethrow_exception(std::exchange(m_error, nullptr));
+                }
+            }
+
+        private:
+            template <typename TFunc>
+            void invoke(TFunc& func)
+            {
+                try {
+                    func();
+                }
+                catch (...) {
+                    std::lock_guard lock{ m_mutex };
+                    if (!m_error) {
+                        m_error = std::current_exception();
+                    }
+                }
+            }
+
+            void join()
+            {
+                while (m_pending.load(std::memory_order_acquire) != 0) {
+                    if (!m_pool.tryRunOne()) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        };
+
+        // executes func(0), ..., func(threads - 1) on the pool - func(0) on the calling thread
+        template <typename TFunc>
+        void forkJoin(std::size_t threads, TFunc func)
+        {
+            task_group group{};
+
+            for (std::size_t index{ 1 }; index < threads; ++index) {
+                group.run([&func, index] { func(index); });
+            }
+            group.run_and_wait([&] { func(0); });
+        }
+
+        // raw storage: elements are constructed at arbitrary positions (scatter)
+        template <typename T>
+        class scatter_buffer
+        {
+        private:
+            std::allocator<T> m_allocator{};
+            T*                m_data{};
+            std::size_t       m_size{};
+            bool              m_constructed{};
+
+        public:
+            explicit scatter_buffer(std::size_t size)
+                : m_data{ m_allocator.allocate(size) }, m_size{ size }
+            {}
+
+            scatter_buffer(const scatter_buffer&) = delete;
+            scatter_buffer& operator= (const scatter_buffer&) = delete;
+
+            ~scatter_buffer()
+            {
+                if (m_constructed) {
+                    std::destroy_n(m_data, m_size);
+                }
+                m_allocator.deallocate(m_data, m_size);
+            }
+
+            T* data() { return m_data; }
+
+            // all elements have been constructed
+            void setConstructed() { m_constructed = true; }
+        };
+
+        template <typename TIter, typename TComp, typename TProj>
+        void sampleSort(TIter first, std::size_t size, TComp comp, TProj proj, std::size_t threads)
+        {
+            using ValueType = std::iter_value_t<TIter>;
+            using Key = std::remove_cvref_t<std::invoke_result_t<TProj&, std::iter_reference_t<TIter>>>;
+
+            constexpr std::size_t Oversampling{ 64 };
+
+            if (threads < 2) {
+                std::ranges::sort(first, first + size, comp, proj);
+                return;
+            }
+
+            // splitters are taken from a random sample
+
+            std::mt19937 generator{ static_cast<std::mt19937::result_type>(size) };
+            std::uniform_int_distribution<std::size_t> positions{ 0, size - 1 };
+
+            std::vector<Key> samples{};
+            samples.reserve(threads * Oversampling);
+            for (std::size_t i{}; i != threads * Oversampling; ++i) {
+                samples.push_back(std::invoke(proj, first[positions(generator)]));
+            }
+            std::ranges::sort(samples, comp);
+
+            std::vector<Key> splitters{};
+            for (std::size_t i{ 1 }; i != threads; ++i) {
+                splitters.push_back(samples[i * Oversampling]);
+            }
+
+            // equal splitters (heavily duplicated keys) are merged into one
+            const auto equivalent = [&](const Key& a, const Key& b) { return !std::invoke(comp, a, b); };
+            splitters.erase(std::ranges::unique(splitters, equivalent).begin(), splitters.end());
+
+            // two buckets per splitter: bucket 2 * i holds the keys less than splitter i
+            // (and not less than splitter i - 1), bucket 2 * i + 1 the keys equal to
+            // splitter i - these are in order already, however many there are
+            const std::size_t buckets{ 2 * splitters.size() + 1 };
+
+            // classify: bucket of every element, histogram per thread
+            std::vector<std::uint16_t> bucketOf(size);
+            std::vector<std::vector<std::size_t>> offsets(threads, std::vector<std::size_t>(buckets));
+
+            auto chunkBegin = [&](std::size_t index) { return size * index / threads; };
+
+            forkJoin(threads, [&](std::size_t index) {
+                for (std::size_t i{ chunkBegin(index) }; i != chunkBegin(index + 1); ++i) {
+                    const auto& key{ std::invoke(proj, first[i]) };
+                    const auto pos{ std::ranges::lower_bound(splitters, key, comp) };
+                    const bool equal{ pos != splitters.end() && !std::invoke(comp, key, *pos) };
+                    const auto bucket{ static_cast<std::uint16_t>(2 * (pos - splitters.begin()) + equal) };
+                    bucketOf[i] = bucket;
+                    ++offsets[index][bucket];
+                }
+            });
+
+            // exclusive prefix sums: bucket major, thread minor
+            std::vector<std::size_t> bucketBegin(buckets + 1);
+            std::size_t offset{};
+            for (std::size_t bucket{}; bucket != buckets; ++bucket) {
+                bucketBegin[bucket] = offset;
+                for (auto& histogram : offsets) {
+                    const std::size_t count{ histogram[bucket] };
+                    histogram[bucket] = offset;
+                    offset += count;
+                }
+            }
+            bucketBegin[buckets] = size;
+
+            // scatter into the buffer, sort every bucket, move back
+            scatter_buffer<ValueType> buffer{ size };
+
+            forkJoin(threads, [&](std::size_t index) {
+                auto& histogram{ offsets[index] };
+                for (std::size_t i{ chunkBegin(index) }; i != chunkBegin(index + 1); ++i) {
+                    std::construct_at(buffer.data() + histogram[bucketOf[i]]++, std::ranges::iter_move(first + i));
+                }
+            });
+            buffer.setConstructed();
+
+            // the buckets differ in size: each thread takes the next unsorted bucket
+            std::atomic<std::size_t> nextBucket{};
+            std::exception_ptr error{};
+
+            try {
+                forkJoin(threads, [&](std::size_t) {
+                    for (std::size_t bucket{ nextBucket++ }; bucket < buckets; bucket = nextBucket++) {
+                        if (bucket % 2 == 0) {
+                            std::ranges::sort(buffer.data() + bucketBegin[bucket], buffer.data() + bucketBegin[bucket + 1], comp, proj);
+                        }
+                    }
+                });
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            // also after an exception: the range keeps all of its elements
+            forkJoin(threads, [&](std::size_t index) {
+                std::ranges::move(buffer.data() + chunkBegin(index), buffer.data() + chunkBegin(index + 1), first + chunkBegin(index));
+            });
+
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // number of elements of [a, a + m) among the first k elements of the
+        // stable merge with [b, b + n) - equal elements are taken from a first
+        template <typename TIn1, typename TIn2, typename TLess>
+        std::size_t coRank(std::size_t k, TIn1 a, std::size_t m, TIn2 b, std::size_t n, TLess& less)
+        {
+            std::size_t low{ k > n ? k - n : 0 };
+            std::size_t high{ std::min(k, m) };
+
+            while (low < high) {
+                const std::size_t i{ low + (high - low) / 2 };
+                const std::size_t j{ k - i };
+
+                // a[i] precedes b[j - 1]: more elements of a are needed
+                if (j > 0 && !less(b[j - 1], a[i])) {
+                    low = i + 1;
+                }
+                else {
+                    high = i;
+                }
+            }
+
+            return low;
+        }
+
+        template <typename TIn1, typename TIn2, typename TOut, typename TLess>
+        void moveMerge(TIn1 first1, TIn1 last1, TIn2 first2, TIn2 last2, TOut out, TLess& less)
+        {
+            while (first1 != last1 && first2 != last2) {
+                if (less(*first2, *first1)) {
+                    *out = std::ranges::iter_move(first2);
+                    ++first2;
+                }
+                else {
+                    *out = std::ranges::iter_move(first1);
+                    ++first1;
+                }
+                ++out;
+            }
+
+            out = std::ranges::move(first1, last1, out).out;
+            std::ranges::move(first2, last2, out);
+        }
+
+        template <typename TIter, typename TComp, typename TProj>
+        void mergeSort(TIter first, std::size_t size, TComp comp, TProj proj, std::size_t threads)
+        {
+            using ValueType = std::iter_value_t<TIter>;
+
+            auto blockBegin = [&](std::size_t index) { return size * index / threads; };
+
+            forkJoin(threads, [&](std::size_t index) {
+                std::ranges::stable_sort(first + blockBegin(index), first + blockBegin(index + 1), comp, proj);
+            });
+
+            if (threads < 2) {
+                return;
+            }
+
+            auto less = [&](const auto& a, const auto& b) {
+                return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+            };
+
+            // the rounds merge alternately from the buffer into the range and back
+            scatter_buffer<ValueType> buffer{ size };
+
+            forkJoin(threads, [&](std::size_t index) {
+                std::ranges::uninitialized_move(
+                    first + blockBegin(index), first + blockBegin(index + 1),
+                    buffer.data() + blockBegin(index), buffer.data() + blockBegin(index + 1));
+            });
+            buffer.setConstructed();
+
+            // one round: adjacent groups of 'width' blocks are merged. Every thread
+            // writes one block of the output, the co-ranks of its first and last
+            // position tell which parts of both inputs it merges
+            auto mergeRound = [&](auto source, auto target, std::size_t width) {
+                forkJoin(threads, [&](std::size_t index) {
+                    const std::size_t left{ index / (2 * width) * (2 * width) };
+                    const std::size_t middle{ std::min(left + width, threads) };
+                    const std::size_t right{ std::min(left + 2 * width, threads) };
+
+                    const auto a{ source + blockBegin(left) };
+                    const auto b{ source + blockBegin(middle) };
+                    const std::size_t m{ blockBegin(middle) - blockBegin(left) };
+                    const std::size_t n{ blockBegin(right) - blockBegin(middle) };
+
+                    const std::size_t from{ blockBegin(index) - blockBegin(left) };
+                    const std::size_t to{ blockBegin(index + 1) - blockBegin(left) };
+
+                    const std::size_t i0{ coRank(from, a, m, b, n, less) };
+                    const std::size_t i1{ coRank(to, a, m, b, n, less) };
+
+                    moveMerge(a + i0, a + i1, b + (from - i0), b + (to - i1), target + blockBegin(index), less);
+                });
+            };
+
+            // log2(threads) rounds, all threads work in every round
+            bool inBuffer{ true };
+
+            for (std::size_t width{ 1 }; width < threads; width *= 2) {
+                if (inBuffer) {
+                    mergeRound(buffer.data(), first, width);
+                }
+                else {
+                    mergeRound(first, buffer.data(), width);
+                }
+                inBuffer = !inBuffer;
+            }
+
+            if (inBuffer) {
+                forkJoin(threads, [&](std::size_t index) {
+                    std::ranges::move(buffer.data() + blockBegin(index), buffer.data() + blockBegin(index + 1), first + blockBegin(index));
+                });
+            }
+        }
+
+        // partitions [first, last) with 'threads' threads, returns the boundary:
+        //   * every thread partitions a chunk of the range
+        //   * misplaced elements - not satisfying the predicate left of the boundary,
+        //     satisfying it right of the boundary - form at most one interval per chunk
+        //     on each side, both sides contain the same number of elements
+        //   * the k-th misplaced element left is swapped with the k-th one right,
+        //     the swaps are divided among the threads
+        template <typename TIter, typename TPred>
+        TIter parallelPartition(TIter first, TIter last, TPred pred, std::size_t threads)
+        {
+            using Interval = std::pair<std::size_t, std::size_t>;
+
+            const auto size{ static_cast<std::size_t>(last - first) };
+
+            auto chunkBegin = [&](std::size_t index) { return size * index / threads; };
+
+            std::vector<std::size_t> middle(threads);
+
+            forkJoin(threads, [&](std::size_t index) {
+                const auto chunk{ std::ranges::partition(first + chunkBegin(index), first + chunkBegin(index + 1), pred) };
+                middle[index] = static_cast<std::size_t>(chunk.begin() - first);
+            });
+
+            std::size_t boundary{};
+            for (std::size_t index{}; index != threads; ++index) {
+                boundary += middle[index] - chunkBegin(index);
+            }
+
+            std::vector<Interval> left{};
+            std::vector<Interval> right{};
+            std::size_t misplaced{};
+
+            for (std::size_t index{}; index != threads; ++index) {
+                const Interval falseLeft{ middle[index], std::min(chunkBegin(index + 1), boundary) };
+                if (falseLeft.first < falseLeft.second) {
+                    left.push_back(falseLeft);
+                    misplaced += falseLeft.second - falseLeft.first;
+                }
+
+                const Interval trueRight{ std::max(chunkBegin(index), boundary), middle[index] };
+                if (trueRight.first < trueRight.second) {
+                    right.push_back(trueRight);
+                }
+            }
+
+            // interval and position of the k-th misplaced element
+            auto locate = [](const std::vector<Interval>& intervals, std::size_t k) {
+                std::size_t interval{};
+                while (k >= intervals[interval].second - intervals[interval].first) {
+                    k -= intervals[interval].second - intervals[interval].first;
+                    ++interval;
+                }
+                return std::pair{ interval, intervals[interval].first + k };
+            };
+
+            forkJoin(threads, [&](std::size_t index) {
+                const std::size_t begin{ misplaced * index / threads };
+                const std::size_t end{ misplaced * (index + 1) / threads };
+
+                if (begin == end) {
+                    return;
+                }
+
+                auto [l, lpos] = locate(left, begin);
+                auto [r, rpos] = locate(right, begin);
+
+                for (std::size_t k{ begin }; k != end; ++k) {
+                    if (lpos == left[l].second) {
+                        lpos = left[++l].first;
+                    }
+                    if (rpos == right[r].second) {
+                        rpos = right[++r].first;
+                    }
+                    std::ranges::iter_swap(first + lpos++, first + rpos++);
+                }
+            });
+
+            return first + boundary;
+        }
+
+        template <typename TIter, typename TComp, typename TProj>
+        void quickSort(TIter first, TIter last, TComp& comp, TProj& proj, std::size_t threads)
+        {
+            constexpr std::ptrdiff_t MinParallelSize{ 100'000 };
+
+            if (threads < 2 || last - first < MinParallelSize) {
+                std::ranges::sort(first, last, comp, proj);
+                return;
+            }
+
+            auto less = [&](const auto& a, const auto& b) {
+                return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+            };
+
+            // median of three as pivot, stored at the first position
+            TIter a{ first }, b{ first + (last - first) / 2 }, c{ last - 1 };
+            if (less(*b, *a)) {
+                std::ranges::swap(a, b);
+            }
+            if (less(*c, *b)) {
+                std::ranges::swap(b, c);
+            }
+            if (less(*b, *a)) {
+                std::ranges::swap(a, b);
+            }
+            std::ranges::iter_swap(first, b);
+
+            // [first + 1, lower): less than pivot, [lower, upper): equal to pivot
+            const auto& pivot{ *first };
+            const auto lower{ parallelPartition(first + 1, last, [&](const auto& elem) { return less(elem, pivot); }, threads) };
+            const auto upper{ parallelPartition(lower, last, [&](const auto& elem) { return !less(pivot, elem); }, threads) };
+            std::ranges::iter_swap(first, lower - 1);
+
+            // the threads are divided in proportion to the sizes of both parts
+            const auto leftSize{ static_cast<std::size_t>(lower - 1 - first) };
+            const auto rightSize{ static_cast<std::size_t>(last - upper) };
+
+            if (leftSize + rightSize == 0) {
+                return;
+            }
+
+            const std::size_t leftThreads{ std::clamp<std::size_t>(threads * leftSize / (leftSize + rightSize), 1, threads - 1) };
+
+            task_group group{};
+            group.run([&, leftThreads] { quickSort(first, lower - 1, comp, proj, leftThreads); });
+            group.run_and_wait([&] { quickSort(upper, last, comp, proj, threads - leftThreads); });
+        }
+    }
+
+    template <std::ranges::random_access_range TRange,
+        typename TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            std::sortable<std::ranges::iterator_t<TRange>, TComp, TProj>
+    void parallel_sort(TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        const auto size{ static_cast<std::size_t>(std::ranges::size(range)) };
+
+        details::sampleSort(std::ranges::begin(range), size, comp, proj, numberOfThreads(size));
+    }
+
+    template <std::ranges::random_access_range TRange,
+        typename TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            std::sortable<std::ranges::iterator_t<TRange>, TComp, TProj>
+    void parallel_stable_sort(TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        const auto size{ static_cast<std::size_t>(std::ranges::size(range)) };
+
+        details::mergeSort(std::ranges::begin(range), size, comp, proj, numberOfThreads(size));
+    }
+
+    template <std::ranges::random_access_range TRange,
+        typename TComp = std::ranges::less,
+        typename TProj = std::identity>
+        requires std::ranges::sized_range<TRange> &&
+            std::sortable<std::ranges::iterator_t<TRange>, TComp, TProj>
+    void parallel_sort_in_place(TRange&& range, TComp comp = {}, TProj proj = {})
+    {
+        const auto size{ static_cast<std::size_t>(std::ranges::size(range)) };
+        const auto first{ std::ranges::begin(range) };
+
+        details::quickSort(first, first + size, comp, proj, numberOfThreads(size));
+    }
+
+    // =======================================================================
+    // examples
+
+    static void printRange(std::string_view msg, auto&& range)
+    {
+        std::print("{}", msg);
+
+        for (const auto& elem : range) {
+            std::print("{} ", elem);
+        }
+        std::println("");
+    }
+
+    struct Task {
+        std::string m_desc{};
+        unsigned int m_priority{ 0 };
+    };
+
+    static void sorting_01_radix_sort()
+    {
+        std::vector<Task> tasks{
+            { "Clean up my apartment", 10 },
+            { "Finish homework", 5 },
+            { "Go to the supermarket", 12 },
+            { "Call grandma", 5 }
+        };
+
+        radix_sort(tasks, std::ranges::greater{}, &Task::m_priority);
+
+        std::println("Next priorities:");
+        for (const auto& task : tasks) {
+            std::println("{}: Priority: {}", task.m_desc, task.m_priority);
+        }
+
+        auto names = std::vector<std::string>{
+            "Alexander", "Dennis", "Bjarne", "Ken", "Stephen", "Dave"
+        };
+
+        radix_sort(names, {}, &std::string::size);
+        printRange("By length: ", names);
+
+        auto values = std::vector{ 3.5, -1.25, 0.0, -0.5, 42.0, -100.0, 7.75 };
+        radix_sort(values);
+        printRange("Doubles:   ", values);
+
+        auto numbers = std::vector{ 5, -4, 3, -2, 1, 6, -7, 8, 9 };
+        radix_sort(std::execution::par, numbers);
+        printRange("Integers:  ", numbers);
+    }
+
+    class Person
+    {
+    public:
+        explicit Person(std::string first, std::string last)
+            : m_firstName{ first }, m_lastName{ last }
+        {}
+
+        const std::string& getFirstName() const { return m_firstName; }
+        const std::string& getLastName() const { return m_lastName; }
+
+    private:
+        std::string m_firstName;
+        std::string m_lastName;
+    };
+
+    static void sorting_03_key_sort()
+    {
+        std::vector<Person> persons
+        {
+            Person{ "John", "Miller" },
+            Person{ "Jack", "Wagner" },
+            Person{ "Anne", "Miller" },
+            Person{ "Hans", "Mueller" },
+            Person{ "Susan", "Baker" }
+        };
+
+        std::size_t calls{};
+        auto lastName = [&](const Person& person) { ++calls; return person.getLastName(); };
+
+        auto copy{ persons };
+        std::ranges::sort(copy, std::ranges::less{}, lastName);
+        std::println("std::ranges::sort: {} projections", calls);
+
+        calls = 0;
+        key_sort(persons, std::ranges::less{}, lastName);
+        std::println("key_sort:          {} projections", calls);
+
+        for (const auto& elem : persons) {
+            std::println("{} {}", elem.getFirstName(), elem.getLastName());
+        }
+
+        // any key type and comparator
+        auto names = std::vector<std::string>{
+            "Alexander", "Dennis", "Bjarne", "Ken", "Stephen", "Dave"
+        };
+
+        key_sort(names, std::ranges::greater{}, [](const std::string& s) { return std::pair{ s.size(), s }; });
+        printRange("By length: ", names);
+    }
+
+    static void sorting_05_parallel_sort()
+    {
+        auto vec = std::vector{ 8, 6, 10, 9, 2, 1, 3, 7, 4, 5 };
+
+        // sorting a sub-view
+        auto firstHalf = vec | std::views::take(vec.size() / 2);
+        parallel_sort(firstHalf);
+        printRange("First half sorted: ", vec);
+
+        parallel_sort_in_place(vec, std::greater<>{});
+        printRange("Descending:        ", vec);
+
+        std::vector<Task> tasks{
+            { "Clean up my apartment", 10 },
+            { "Finish homework", 5 },
+            { "Go to the supermarket", 12 },
+            { "Call grandma", 5 }
+        };
+
+        parallel_stable_sort(tasks, std::ranges::greater{}, &Task::m_priority);
+
+        std::println("Next priorities:");
+        for (const auto& task : tasks) {
+            std::println("{}: Priority: {}", task.m_desc, task.m_priority);
+        }
+
+        // an exception of the comparator reaches the caller, also from a worker thread
+        std::vector<int> numbers(1'000'000);
+        std::iota(numbers.rbegin(), numbers.rend(), 0);
+
+        std::atomic<std::size_t> comparisons{};
+        auto failing = [&](int a, int b) {
+            if (++comparisons == 5'000'000) {
+                throw std::runtime_error{ "comparison failed" };
+            }
+            return a < b;
+        };
+
+        try {
+            parallel_sort(numbers, failing);
+        }
+        catch (const std::runtime_error& e) {
+            std::println("Exception: {}", e.what());
+        }
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    struct Job {
+        unsigned int m_priority{};
+        int m_id{};
+    };
+
+    // order dependent checksum
+    static std::size_t checksum(const std::vector<Job>& jobs)
+    {
+        std::size_t result{};
+        for (const auto& job : jobs) {
+            result = result * 31 + static_cast<std::size_t>(job.m_id);
+        }
+        return result;
+    }
+
+    static void sorting_02_radix_sort_benchmark()
+    {
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<unsigned int> priorities{ 0, 1'000'000'000 };
+
+        for (std::size_t size : { 1'000'000, 10'000'000, 100'000'000 }) {
+
+            std::vector<Job> jobs(size);
+            for (int id{}; auto& job : jobs) {
+                job = { priorities(generator), id++ };
+            }
+
+            std::println("{} elements:", size);
+
+            measure("  std::ranges::sort:", [=]() mutable {
+                std::ranges::sort(jobs, {}, &Job::m_priority);
+                return checksum(jobs);
+            });
+
+            measure("  std::ranges::stable_sort:", [=]() mutable {
+                std::ranges::stable_sort(jobs, {}, &Job::m_priority);
+                return checksum(jobs);
+            });
+
+            measure("  radix_sort:", [=]() mutable {
+                radix_sort(jobs, {}, &Job::m_priority);
+                return checksum(jobs);
+            });
+
+            measure("  radix_sort (parallel):", [=]() mutable {
+                radix_sort(std::execution::par, jobs, {}, &Job::m_priority);
+                return checksum(jobs);
+            });
+        }
+    }
+
+    static std::string randomName(std::mt19937& generator)
+    {
+        std::uniform_int_distribution<int> letters{ 'a', 'z' };
+
+        std::string name(12, ' ');
+        name[0] = static_cast<char>(std::toupper(letters(generator)));
+        for (std::size_t i{ 1 }; i != name.size(); ++i) {
+            name[i] = static_cast<char>(letters(generator));
+        }
+        return name;
+    }
+
+    // order dependent checksum
+    static std::size_t checksum(const std::vector<Person>& persons)
+    {
+        std::size_t result{};
+        for (const auto& person : persons) {
+            result = result * 31 + std::hash<std::string>{}(person.getFirstName());
+        }
+        return result;
+    }
+
+    static void sorting_04_key_sort_benchmark()
+    {
+        constexpr std::size_t Size{ 2'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> families{ 0, Size / 4 };
+
+        // about four persons share a last name
+        std::vector<std::string> lastNames(Size / 4 + 1);
+        for (auto& name : lastNames) {
+            name = randomName(generator);
+        }
+
+        std::vector<Person> persons{};
+        persons.reserve(Size);
+        for (std::size_t i{}; i != Size; ++i) {
+            persons.emplace_back(std::format("Person {}", i), lastNames[families(generator)]);
+        }
+
+        auto byValue = [](const Person& person) { return person.getLastName(); };
+
+        std::println("{} persons:", Size);
+
+        measure("  std::ranges::stable_sort (by value):", [=]() mutable {
+            std::ranges::stable_sort(persons, std::ranges::less{}, byValue);
+            return checksum(persons);
+        });
+
+        measure("  std::ranges::stable_sort (by ref):", [=]() mutable {
+            std::ranges::stable_sort(persons, std::ranges::less{}, &Person::getLastName);
+            return checksum(persons);
+        });
+
+        measure("  key_sort (by value):", [=]() mutable {
+            key_sort(persons, std::ranges::less{}, byValue);
+            return checksum(persons);
+        });
+
+        measure("  key_sort (by ref):", [=]() mutable {
+            key_sort(persons, std::ranges::less{}, &Person::getLastName);
+            return checksum(persons);
+        });
+    }
+
+    // order dependent checksum
+    static std::size_t checksum(const std::vector<int>& values)
+    {
+        std::size_t result{};
+        for (const int value : values) {
+            result = result * 31 + static_cast<std::size_t>(value);
+        }
+        return result;
+    }
+
+    // the input of every run is generated anew: no second copy of the data
+    static void parallel_sort_benchmark(std::size_t size, int maxValue)
+    {
+        std::vector<int> values(size);
+
+        auto run = [&](std::string_view label, auto sort) {
+            std::mt19937 generator{ 1 };
+            std::uniform_int_distribution<int> distribution{ 0, maxValue };
+            for (auto& value : values) {
+                value = distribution(generator);
+            }
+
+            measure(label, [&] {
+                sort(values);
+                return checksum(values);
+            });
+        };
+
+        run("  std::ranges::sort:", [](auto& v) { std::ranges::sort(v); });
+        run("  std::ranges::stable_sort:", [](auto& v) { std::ranges::stable_sort(v); });
+        run("  parallel_sort:", [](auto& v) { parallel_sort(v); });
+        run("  parallel_stable_sort:", [](auto& v) { parallel_stable_sort(v); });
+        run("  parallel_sort_in_place:", [](auto& v) { parallel_sort_in_place(v); });
+    }
+
+    static void sorting_06_parallel_sort_benchmark()
+    {
+        // 4 GB of ints, the sorts need up to 6 GB in addition
+        constexpr std::size_t Size{ 1'000'000'000 };
+
+        std::println("{} ints, {} threads:", Size, std::thread::hardware_concurrency());
+        parallel_sort_benchmark(Size, std::numeric_limits<int>::max());
+
+        // heavily duplicated keys: 16 different values
+        std::println("{} ints, 16 different values:", Size);
+        parallel_sort_benchmark(Size, 15);
+    }
+}
+
+void ranges_13_sorting()
+{
+    using namespace Cpp20RangesSorting;
+
+    sorting_01_radix_sort();
+    sorting_02_radix_sort_benchmark();
+    sorting_03_key_sort();
+    sorting_04_key_sort_benchmark();
+    sorting_05_parallel_sort();
+    sorting_06_parallel_sort_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,332 @@
+// ===========================================================================
+// Ranges_14_SearchIndex.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SEARCH_INDEX_PREFETCH
+#include <immintrin.h>
+#endif
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesSearchIndex
+{
+    // =======================================================================
+    // cache_aligned_allocator: storage starts at a cache line boundary
+
+    inline constexpr std::size_t CacheLineSize{ 64 };
+
+    template <typename T>
+    struct cache_aligned_allocator
+    {
+        using value_type = T;
+
+        static constexpr std::align_val_t Alignment{ std::max(CacheLineSize, alignof(T)) };
+
+        cache_aligned_allocator() = default;
+
+        template <typename U>
+        cache_aligned_allocator(const cache_aligned_allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t count)
+        {
+            if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length{};
+            }
+            return static_cast<T*>(::operator new(count * sizeof(T), Alignment));
+        }
+
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            ::operator delete(ptr, count * sizeof(T), Alignment);
+        }
+
+        template <typename U>
+        bool operator==(const cache_aligned_allocator<U>&) const noexcept { return true; }
+    };
+
+    // =======================================================================
+    // eytzinger_index: static search index in Eytzinger layout
+    //
+    // The sorted elements are stored in the order of a breadth-first traversal
+    // of a complete binary search tree (1-based: the children of node k are
+    // the nodes 2k and 2k + 1). The first levels of the tree share a few cache
+    // lines. The PrefetchStride = 64 / sizeof(T) descendants log2(PrefetchStride)
+    // levels below node k are stored adjacent at index PrefetchStride * k - with
+    // the tree aligned to 64 bytes they fill exactly one cache line, which is
+    // prefetched while the search continues.
+
+    template <typename T, typename TComp = std::ranges::less>
+        requires std::strict_weak_order<TComp&, const T&, const T&>
+    class eytzinger_index
+    {
+    private:
+        static constexpr std::size_t PrefetchStride{
+            std::bit_floor(std::max<std::size_t>(CacheLineSize / sizeof(T), 1))
+        };
+
+        std::vector<T, cache_aligned_allocator<T>> m_tree;      // m_tree[0] is not used
+        std::size_t    m_size;
+        std::size_t    m_height;
+        TComp          m_comp;
+
+    public:
+        template <std::ranges::input_range TRange>
+            requires std::convertible_to<std::ranges::range_reference_t<TRange>, T>
+        explicit eytzinger_index(TRange&& range, TComp comp = {})
+            : m_tree{}, m_size{}, m_height{}, m_comp{ comp }
+        {
+            std::vector<T> sorted{};
+            for (auto&& elem : range) {
+                sorted.push_back(std::forward<decltype(elem)>(elem));
+            }
+
+            if (!std::ranges::is_sorted(sorted, m_comp)) {
+                std::ranges::sort(sorted, m_comp);
+            }
+
+            m_size = sorted.size();
+            m_height = static_cast<std::size_t>(std::bit_width(m_size));
+            m_tree.resize(m_size + 1);
+
+            std::size_t next{};
+            build(sorted, next, 1);
+        }
+
+        std::size_t size() const { return m_size; }
+
+        // first element not less than key - or nullptr
+        const T* lower_bound(const T& key) const
+        {
+            std::size_t k{ 1 };
+
+            while (k <= m_size) {
+                prefetch(k * PrefetchStride);
+                k = 2 * k + static_cast<std::size_t>(std::invoke(m_comp, m_tree[k], key));
+            }
+
+            return result(k);
+        }
+
+        bool contains(const T& key) const
+        {
+            const T* pos{ lower_bound(key) };
+            return pos != nullptr && !std::invoke(m_comp, key, *pos);
+        }
+
+        // batched queries: a group of searches descends the tree level by
+        // level, the cache misses of the group overlap each other
+        void lower_bound_batch(std::span<const T> keys, std::span<const T*> results) const
+        {
+            constexpr std::size_t GroupSize{ 16 };
+
+            std::array<std::size_t, GroupSize> positions{};
+
+            for (std::size_t first{}; first < keys.size(); first += GroupSize) {
+
+                const std::size_t count{ std::min(GroupSize, keys.size() - first) };
+
+                positions.fill(1);
+
+                for (std::size_t level{}; level != m_height; ++level) {
+                    for (std::size_t i{}; i != count; ++i) {
+                        std::size_t& k{ positions[i] };
+                        if (k <= m_size) {
+                            k = 2 * k + static_cast<std::size_t>(std::invoke(m_comp, m_tree[k], keys[first + i]));
+                            prefetch(k * PrefetchStride);
+                        }
+                    }
+                }
+
+                for (std::size_t i{}; i != count; ++i) {
+                    results[first + i] = result(positions[i]);
+                }
+            }
+        }
+
+        void contains_batch(std::span<const T> keys, std::span<bool> results) const
+        {
+            std::vector<const T*> positions(keys.size());
+            lower_bound_batch(keys, positions);
+
+            for (std::size_t i{}; i != keys.size(); ++i) {
+                results[i] = positions[i] != nullptr && !std::invoke(m_comp, keys[i], *positions[i]);
+            }
+        }
+
+    private:
+        // in-order traversal of the tree assigns the sorted elements
+        void build(std::vector<T>& sorted, std::size_t& next, std::size_t k)
+        {
+            if (k <= m_size) {
+                build(sorted, next, 2 * k);
+                m_tree[k] = std::move(sorted[next++]);
+                build(sorted, next, 2 * k + 1);
+            }
+        }
+
+        // the search went right (bit 1) while the node was less than the key,
+        // the answer is the node where it went left for the last time
+        const T* result(std::size_t k) const
+        {
+            k >>= std::countr_one(k) + 1;
+            return k == 0 ? nullptr : &m_tree[k];
+        }
+
+        void prefetch(std::size_t k) const
+        {
+#if defined(SEARCH_INDEX_PREFETCH)
+            // a single element per cache line: nothing to gain
+            if (PrefetchStride > 1 && k < m_tree.size()) {
+                _mm_prefetch(reinterpret_cast<const char*>(m_tree.data() + k), _MM_HINT_T0);
+            }
+#endif
+        }
+    };
+
+    template <std::ranges::input_range TRange>
+    eytzinger_index(TRange&&) -> eytzinger_index<std::ranges::range_value_t<TRange>>;
+
+    template <std::ranges::input_range TRange, typename TComp>
+    eytzinger_index(TRange&&, TComp) -> eytzinger_index<std::ranges::range_value_t<TRange>, TComp>;
+
+    // =======================================================================
+    // examples
+
+    static void search_index_01_introduction()
+    {
+        auto vec = std::vector{ 2, 2, 3, 3, 3, 4, 5, 8, 13, 21 };     // sorted!
+
+        eytzinger_index index{ vec };
+
+        std::println("Contains 3: {}", index.contains(3));
+        std::println("Contains 7: {}", index.contains(7));
+
+        for (int key : { 0, 3, 6, 21, 22 }) {
+            const int* pos{ index.lower_bound(key) };
+            if (pos != nullptr) {
+                std::println("lower_bound({:2}): {}", key, *pos);
+            }
+            else {
+                std::println("lower_bound({:2}): -", key);
+            }
+        }
+
+        // batched queries
+        std::vector<int> keys{ 1, 2, 4, 7, 13, 20 };
+        std::unique_ptr<bool[]> results{ std::make_unique<bool[]>(keys.size()) };
+
+        index.contains_batch(keys, std::span<bool>{ results.get(), keys.size() });
+
+        for (std::size_t i{}; i != keys.size(); ++i) {
+            std::print("{}: {}  ", keys[i], results[i]);
+        }
+        std::println("");
+
+        // other comparators
+        auto names = std::vector<std::string>{ "Stephen", "Dennis", "Bjarne", "Ken", "Alexander" };
+        eytzinger_index descending{ names, std::ranges::greater{} };
+        std::println("Contains Ken: {}", descending.contains("Ken"));
+    }
+
+    // =======================================================================
+    // benchmark
+
+    template <typename TFunc>
+    static void measure(std::string_view label, std::size_t queries, TFunc func)
+    {
+        const auto [checksum, elapsed] { Helpers::stopwatch(func) };
+
+        const auto msecs{ std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() };
+        const double millionQueries{ static_cast<double>(queries) / 1'000'000.0 };
+        const double seconds{ std::chrono::duration<double>(elapsed).count() };
+
+        std::println("{:<32} {:>6} msecs {:>8.2f} Mqueries/sec (checksum {})",
+            label, msecs, millionQueries / seconds, checksum);
+    }
+
+    static void search_index_02_benchmark()
+    {
+        constexpr std::size_t Queries{ 10'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> distribution{ 0, std::numeric_limits<int>::max() };
+
+        std::vector<int> keys(Queries);
+        for (auto& key : keys) {
+            key = distribution(generator);
+        }
+
+        for (std::size_t size : { 10'000, 1'000'000, 10'000'000 }) {
+
+            std::vector<int> values(size);
+            for (auto& value : values) {
+                value = distribution(generator);
+            }
+            std::ranges::sort(values);
+
+            eytzinger_index index{ values };
+
+            std::println("{} elements, {} queries:", size, Queries);
+
+            measure("  std::ranges::lower_bound:", Queries, [&] {
+                long long checksum{};
+                for (int key : keys) {
+                    const auto pos{ std::ranges::lower_bound(values, key) };
+                    checksum += (pos != values.end()) ? *pos : 0;
+                }
+                return checksum;
+            });
+
+            measure("  eytzinger_index::lower_bound:", Queries, [&] {
+                long long checksum{};
+                for (int key : keys) {
+                    const int* pos{ index.lower_bound(key) };
+                    checksum += (pos != nullptr) ? *pos : 0;
+                }
+                return checksum;
+            });
+
+            measure("  eytzinger_index (batched):", Queries, [&] {
+                std::vector<const int*> results(keys.size());
+                index.lower_bound_batch(keys, results);
+
+                long long checksum{};
+                for (const int* pos : results) {
+                    checksum += (pos != nullptr) ? *pos : 0;
+                }
+                return checksum;
+            });
+
+            measure("  std::ranges::binary_search:", Queries, [&] {
+                std::size_t checksum{};
+                for (int key : keys) {
+                    checksum += std::ranges::binary_search(values, key) ? 1 : 0;
+                }
+                return checksum;
+            });
+
+            measure("  eytzinger_index::contains:", Queries, [&] {
+                std::size_t checksum{};
+                for (int key : keys) {
+                    checksum += index.contains(key) ? 1 : 0;
+                }
+                return checksum;
+            });
+        }
+    }
+}
+
+void ranges_14_search_index()
+{
+    using namespace Cpp20RangesSearchIndex;
+
+    search_index_01_introduction();
+    search_index_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,1149 @@
+// ===========================================================================
+// Ranges_15_SimdAlgorithms.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SIMD_ALGORITHMS_X64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// GCC and Clang: intrinsics of instruction sets not enabled on the command
+// line are only available in functions with a corresponding target attribute
+#if defined(SIMD_ALGORITHMS_X64) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET_AVX2   __attribute__((target("avx2")))
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SIMD_TARGET_AVX2
+#define SIMD_TARGET_AVX512
+#endif
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesSimdAlgorithms
+{
+    // =======================================================================
+    // simple comparison predicates: "element op value"
+
+    enum class compare_op { equal, not_equal, less, less_equal, greater, greater_equal };
+
+    template <typename T>
+    struct compare_with
+    {
+        compare_op m_op;
+        T          m_value;
+
+        constexpr bool operator() (const T& elem) const
+        {
+            switch (m_op) {
+            case compare_op::equal:         return elem == m_value;
+            case compare_op::not_equal:     return elem != m_value;
+            case compare_op::less:          return elem < m_value;
+            case compare_op::less_equal:    return elem <= m_value;
+            case compare_op::greater:       return elem > m_value;
+            case compare_op::greater_equal: return elem >= m_value;
+            }
+            return false;
+        }
+    };
+
+    namespace pred
+    {
+        template <typename T> constexpr compare_with<T> equal_to(T value) { return { compare_op::equal, value }; }
+        template <typename T> constexpr compare_with<T> not_equal_to(T value) { return { compare_op::not_equal, value }; }
+        template <typename T> constexpr compare_with<T> less_than(T value) { return { compare_op::less, value }; }
+        template <typename T> constexpr compare_with<T> less_equal(T value) { return { compare_op::less_equal, value }; }
+        template <typename T> constexpr compare_with<T> greater_than(T value) { return { compare_op::greater, value }; }
+        template <typename T> constexpr compare_with<T> greater_equal(T value) { return { compare_op::greater_equal, value }; }
+    }
+
+    // =======================================================================
+    // runtime detection of the instruction set (CPUID)
+
+    enum class simd_level { scalar, sse2, avx2, avx512 };
+
+    static std::string_view toString(simd_level level)
+    {
+        switch (level) {
+        case simd_level::sse2:   return "SSE2";
+        case simd_level::avx2:   return "AVX2";
+        case simd_level::avx512: return "AVX-512";
+        default:                 return "Scalar";
+        }
+    }
+
+    namespace details
+    {
+#if defined(SIMD_ALGORITHMS_X64)
+        static std::array<unsigned int, 4> cpuid(unsigned int leaf, unsigned int subleaf)
+        {
+            std::array<unsigned int, 4> regs{};
+#if defined(_MSC_VER)
+            int info[4]{};
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (std::size_t i{}; i != regs.size(); ++i) {
+                regs[i] = static_cast<unsigned int>(info[i]);
+            }
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+            return regs;
+        }
+
+        // register state enabled by the operating system (XCR0)
+        static std::uint64_t xgetbv()
+        {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            unsigned int eax{}, edx{};
+            __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+        }
+#endif
+
+        static simd_level detectSimdLevel()
+        {
+#if defined(SIMD_ALGORITHMS_X64)
+            const unsigned int maxLeaf{ cpuid(0, 0)[0] };
+            const auto leaf1{ cpuid(1, 0) };
+
+            const bool osxsave{ (leaf1[2] & (1u << 27)) != 0 };
+            const bool avx{ (leaf1[2] & (1u << 28)) != 0 };
+
+            if (!osxsave || !avx || maxLeaf < 7) {
+                return simd_level::sse2;     // SSE2 is part of every x64 processor
+            }
+
+            const std::uint64_t xcr0{ xgetbv() };
+            const bool ymmState{ (xcr0 & 0x06) == 0x06 };   // XMM and YMM registers
+            const bool zmmState{ (xcr0 & 0xE6) == 0xE6 };   // additionally opmask and ZMM registers
+
+            const auto leaf7{ cpuid(7, 0) };
+            const bool avx2{ (leaf7[1] & (1u << 5)) != 0 };
+            const bool avx512f{ (leaf7[1] & (1u << 16)) != 0 };
+
+            if (avx512f && zmmState) {
+                return simd_level::avx512;
+            }
+            if (avx2 && ymmState) {
+                return simd_level::avx2;
+            }
+            return simd_level::sse2;
+#else
+            return simd_level::scalar;
+#endif
+        }
+
+        inline simd_level& activeLevel()
+        {
+            static simd_level level{ detectSimdLevel() };
+            return level;
+        }
+    }
+
+    inline simd_level supportedSimdLevel()
+    {
+        static const simd_level level{ details::detectSimdLevel() };
+        return level;
+    }
+
+    inline simd_level currentSimdLevel() { return details::activeLevel(); }
+
+    // selects a lower level, e.g. for comparisons
+    inline void setSimdLevel(simd_level level)
+    {
+        details::activeLevel() = std::min(level, supportedSimdLevel());
+    }
+
+    // =======================================================================
+    // kernels: one namespace per instruction set, identical interface
+    //
+    //   findIf<T, Op>      index of the first element "elem op value"
+    //   findLast           index of the last element equal to value
+    //   countIf<T, Op>     number of elements "elem op value"
+    //   minMaxValues       smallest and largest value (size > 0)
+    //   clamp              out[i] = std::clamp(data[i], lo, hi)
+    //
+    // Counters are kept per lane (32 bit), ranges with more than
+    // 2^32 * lanes elements are not supported.
+
+    namespace scalar
+    {
+        template <typename T, compare_op Op>
+        std::size_t findIf(const T* data, std::size_t size, T value)
+        {
+            const compare_with<T> pred{ Op, value };
+            for (std::size_t i{}; i != size; ++i) {
+                if (pred(data[i])) {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        template <typename T>
+        std::size_t findLast(const T* data, std::size_t size, T value)
+        {
+            for (std::size_t i{ size }; i != 0; --i) {
+                if (data[i - 1] == value) {
+                    return i - 1;
+                }
+            }
+            return size;
+        }
+
+        template <typename T, compare_op Op>
+        std::size_t countIf(const T* data, std::size_t size, T value)
+        {
+            const compare_with<T> pred{ Op, value };
+            std::size_t count{};
+            for (std::size_t i{}; i != size; ++i) {
+                count += pred(data[i]) ? 1 : 0;
+            }
+            return count;
+        }
+
+        template <typename T>
+        std::pair<T, T> minMaxValues(const T* data, std::size_t size)
+        {
+            T lo{ data[0] }, hi{ data[0] };
+            for (std::size_t i{ 1 }; i != size; ++i) {
+                lo = std::min(lo, data[i]);
+                hi = std::max(hi, data[i]);
+            }
+            return { lo, hi };
+        }
+
+        template <typename T>
+        void clamp(const T* data, std::size_t size, T lo, T hi, T* out)
+        {
+            for (std::size_t i{}; i != size; ++i) {
+                out[i] = std::clamp(data[i], lo, hi);
+            }
+        }
+    }
+
+#if defined(SIMD_ALGORITHMS_X64)
+
+    namespace sse2
+    {
+        constexpr std::size_t Lanes{ 4 };
+
+        inline __m128i load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        inline __m128  load(const float* p) { return _mm_loadu_ps(p); }
+        inline void store(int* p, __m128i x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x); }
+        inline void store(float* p, __m128 x) { _mm_storeu_ps(p, x); }
+        inline __m128i broadcast(int value) { return _mm_set1_epi32(value); }
+        inline __m128  broadcast(float value) { return _mm_set1_ps(value); }
+
+        // all bits of a lane are set if the comparison is true
+        template <compare_op Op>
+        __m128i compare(__m128i x, __m128i v)
+        {
+            const __m128i ones{ _mm_set1_epi32(-1) };
+
+            if constexpr (Op == compare_op::equal) { return _mm_cmpeq_epi32(x, v); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm_xor_si128(_mm_cmpeq_epi32(x, v), ones); }
+            else if constexpr (Op == compare_op::less) { return _mm_cmplt_epi32(x, v); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm_xor_si128(_mm_cmpgt_epi32(x, v), ones); }
+            else if constexpr (Op == compare_op::greater) { return _mm_cmpgt_epi32(x, v); }
+            else { return _mm_xor_si128(_mm_cmplt_epi32(x, v), ones); }
+        }
+
+        template <compare_op Op>
+        __m128i compare(__m128 x, __m128 v)
+        {
+            if constexpr (Op == compare_op::equal) { return _mm_castps_si128(_mm_cmpeq_ps(x, v)); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm_castps_si128(_mm_cmpneq_ps(x, v)); }
+            else if constexpr (Op == compare_op::less) { return _mm_castps_si128(_mm_cmplt_ps(x, v)); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm_castps_si128(_mm_cmple_ps(x, v)); }
+            else if constexpr (Op == compare_op::greater) { return _mm_castps_si128(_mm_cmpgt_ps(x, v)); }
+            else { return _mm_castps_si128(_mm_cmpge_ps(x, v)); }
+        }
+
+        inline unsigned int movemask(__m128i mask)
+        {
+            return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(mask)));
+        }
+
+        // SSE2 has no _mm_min_epi32 / _mm_max_epi32 (SSE4.1)
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        inline __m128i min(__m128i a, __m128i b) { return select(_mm_cmplt_epi32(a, b), a, b); }
+        inline __m128i max(__m128i a, __m128i b) { return select(_mm_cmpgt_epi32(a, b), a, b); }
+        inline __m128  min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+        inline __m128  max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+
+        // std::clamp: (x < lo) ? lo : (hi < x) ? hi : x - for int the same as min / max,
+        // for float not: min / max differ for NaN and for -0.0 / +0.0
+        inline __m128i clampLanes(__m128i x, __m128i lo, __m128i hi) { return min(max(x, lo), hi); }
+
+        inline __m128 clampLanes(__m128 x, __m128 lo, __m128 hi)
+        {
+            auto select = [](__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); };
+
+            const __m128 upper{ select(_mm_cmplt_ps(hi, x), hi, x) };
+            return select(_mm_cmplt_ps(x, lo), lo, upper);
+        }
+
+        template <typename T, compare_op Op>
+        std::size_t findIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                const unsigned int mask{ movemask(compare<Op>(load(data + i), v)) };
+                if (mask != 0) {
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+
+            return i + scalar::findIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        std::size_t findLast(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{ size };
+            for (; i >= Lanes; i -= Lanes) {
+                const unsigned int mask{ movemask(compare<compare_op::equal>(load(data + i - Lanes), v)) };
+                if (mask != 0) {
+                    return i - Lanes + static_cast<std::size_t>(std::bit_width(mask)) - 1;
+                }
+            }
+
+            const std::size_t pos{ scalar::findLast(data, i, value) };
+            return pos != i ? pos : size;
+        }
+
+        template <typename T, compare_op Op>
+        std::size_t countIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+            __m128i counts{ _mm_setzero_si128() };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                counts = _mm_sub_epi32(counts, compare<Op>(load(data + i), v));   // true == -1
+            }
+
+            std::array<std::uint32_t, Lanes> lanes{};
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.data()), counts);
+
+            std::size_t count{};
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+
+            return count + scalar::countIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        std::pair<T, T> minMaxValues(const T* data, std::size_t size)
+        {
+            if (size < Lanes) {
+                return scalar::minMaxValues(data, size);
+            }
+
+            auto lo{ load(data) };
+            auto hi{ lo };
+
+            std::size_t i{ Lanes };
+            for (; i + Lanes <= size; i += Lanes) {
+                const auto x{ load(data + i) };
+                lo = min(lo, x);
+                hi = max(hi, x);
+            }
+
+            std::array<T, Lanes> los{}, his{};
+            store(los.data(), lo);
+            store(his.data(), hi);
+
+            T minValue{ std::ranges::min(los) };
+            T maxValue{ std::ranges::max(his) };
+            for (; i != size; ++i) {
+                minValue = std::min(minValue, data[i]);
+                maxValue = std::max(maxValue, data[i]);
+            }
+
+            return { minValue, maxValue };
+        }
+
+        template <typename T>
+        void clamp(const T* data, std::size_t size, T lo, T hi, T* out)
+        {
+            const auto vlo{ broadcast(lo) };
+            const auto vhi{ broadcast(hi) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                store(out + i, clampLanes(load(data + i), vlo, vhi));
+            }
+
+            scalar::clamp(data + i, size - i, lo, hi, out + i);
+        }
+    }
+
+    namespace avx2
+    {
+        constexpr std::size_t Lanes{ 8 };
+
+        SIMD_TARGET_AVX2 inline __m256i load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        SIMD_TARGET_AVX2 inline __m256  load(const float* p) { return _mm256_loadu_ps(p); }
+        SIMD_TARGET_AVX2 inline void store(int* p, __m256i x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x); }
+        SIMD_TARGET_AVX2 inline void store(float* p, __m256 x) { _mm256_storeu_ps(p, x); }
+        SIMD_TARGET_AVX2 inline __m256i broadcast(int value) { return _mm256_set1_epi32(value); }
+        SIMD_TARGET_AVX2 inline __m256  broadcast(float value) { return _mm256_set1_ps(value); }
+
+        template <compare_op Op>
+        SIMD_TARGET_AVX2 __m256i compare(__m256i x, __m256i v)
+        {
+            const __m256i ones{ _mm256_set1_epi32(-1) };
+
+            if constexpr (Op == compare_op::equal) { return _mm256_cmpeq_epi32(x, v); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm256_xor_si256(_mm256_cmpeq_epi32(x, v), ones); }
+            else if constexpr (Op == compare_op::less) { return _mm256_cmpgt_epi32(v, x); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm256_xor_si256(_mm256_cmpgt_epi32(x, v), ones); }
+            else if constexpr (Op == compare_op::greater) { return _mm256_cmpgt_epi32(x, v); }
+            else { return _mm256_xor_si256(_mm256_cmpgt_epi32(v, x), ones); }
+        }
+
+        template <compare_op Op>
+        SIMD_TARGET_AVX2 __m256i compare(__m256 x, __m256 v)
+        {
+            if constexpr (Op == compare_op::equal) { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_EQ_OQ)); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_NEQ_UQ)); }
+            else if constexpr (Op == compare_op::less) { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_LT_OQ)); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_LE_OQ)); }
+            else if constexpr (Op == compare_op::greater) { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_GT_OQ)); }
+            else { return _mm256_castps_si256(_mm256_cmp_ps(x, v, _CMP_GE_OQ)); }
+        }
+
+        SIMD_TARGET_AVX2 inline unsigned int movemask(__m256i mask)
+        {
+            return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+        }
+
+        SIMD_TARGET_AVX2 inline __m256i min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+        SIMD_TARGET_AVX2 inline __m256i max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+        SIMD_TARGET_AVX2 inline __m256  min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+        SIMD_TARGET_AVX2 inline __m256  max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+
+        // std::clamp semantics (see sse2::clampLanes)
+        SIMD_TARGET_AVX2 inline __m256i clampLanes(__m256i x, __m256i lo, __m256i hi) { return min(max(x, lo), hi); }
+
+        SIMD_TARGET_AVX2 inline __m256 clampLanes(__m256 x, __m256 lo, __m256 hi)
+        {
+            const __m256 upper{ _mm256_blendv_ps(x, hi, _mm256_cmp_ps(hi, x, _CMP_LT_OQ)) };
+            return _mm256_blendv_ps(upper, lo, _mm256_cmp_ps(x, lo, _CMP_LT_OQ));
+        }
+
+        template <typename T, compare_op Op>
+        SIMD_TARGET_AVX2 std::size_t findIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                const unsigned int mask{ movemask(compare<Op>(load(data + i), v)) };
+                if (mask != 0) {
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+
+            return i + scalar::findIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX2 std::size_t findLast(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{ size };
+            for (; i >= Lanes; i -= Lanes) {
+                const unsigned int mask{ movemask(compare<compare_op::equal>(load(data + i - Lanes), v)) };
+                if (mask != 0) {
+                    return i - Lanes + static_cast<std::size_t>(std::bit_width(mask)) - 1;
+                }
+            }
+
+            const std::size_t pos{ scalar::findLast(data, i, value) };
+            return pos != i ? pos : size;
+        }
+
+        template <typename T, compare_op Op>
+        SIMD_TARGET_AVX2 std::size_t countIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+            __m256i counts{ _mm256_setzero_si256() };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                counts = _mm256_sub_epi32(counts, compare<Op>(load(data + i), v));
+            }
+
+            std::array<std::uint32_t, Lanes> lanes{};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.data()), counts);
+
+            std::size_t count{};
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+
+            return count + scalar::countIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX2 std::pair<T, T> minMaxValues(const T* data, std::size_t size)
+        {
+            if (size < Lanes) {
+                return scalar::minMaxValues(data, size);
+            }
+
+            auto lo{ load(data) };
+            auto hi{ lo };
+
+            std::size_t i{ Lanes };
+            for (; i + Lanes <= size; i += Lanes) {
+                const auto x{ load(data + i) };
+                lo = min(lo, x);
+                hi = max(hi, x);
+            }
+
+            std::array<T, Lanes> los{}, his{};
+            store(los.data(), lo);
+            store(his.data(), hi);
+
+            T minValue{ std::ranges::min(los) };
+            T maxValue{ std::ranges::max(his) };
+            for (; i != size; ++i) {
+                minValue = std::min(minValue, data[i]);
+                maxValue = std::max(maxValue, data[i]);
+            }
+
+            return { minValue, maxValue };
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX2 void clamp(const T* data, std::size_t size, T lo, T hi, T* out)
+        {
+            const auto vlo{ broadcast(lo) };
+            const auto vhi{ broadcast(hi) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                store(out + i, clampLanes(load(data + i), vlo, vhi));
+            }
+
+            scalar::clamp(data + i, size - i, lo, hi, out + i);
+        }
+    }
+
+    namespace avx512
+    {
+        constexpr std::size_t Lanes{ 16 };
+
+        SIMD_TARGET_AVX512 inline __m512i load(const int* p) { return _mm512_loadu_si512(p); }
+        SIMD_TARGET_AVX512 inline __m512  load(const float* p) { return _mm512_loadu_ps(p); }
+        SIMD_TARGET_AVX512 inline void store(int* p, __m512i x) { _mm512_storeu_si512(p, x); }
+        SIMD_TARGET_AVX512 inline void store(float* p, __m512 x) { _mm512_storeu_ps(p, x); }
+        SIMD_TARGET_AVX512 inline __m512i broadcast(int value) { return _mm512_set1_epi32(value); }
+        SIMD_TARGET_AVX512 inline __m512  broadcast(float value) { return _mm512_set1_ps(value); }
+
+        // AVX-512 comparisons yield a bit mask (one bit per lane)
+        template <compare_op Op>
+        SIMD_TARGET_AVX512 __mmask16 compare(__m512i x, __m512i v)
+        {
+            if constexpr (Op == compare_op::equal) { return _mm512_cmpeq_epi32_mask(x, v); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm512_cmpneq_epi32_mask(x, v); }
+            else if constexpr (Op == compare_op::less) { return _mm512_cmplt_epi32_mask(x, v); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm512_cmple_epi32_mask(x, v); }
+            else if constexpr (Op == compare_op::greater) { return _mm512_cmpgt_epi32_mask(x, v); }
+            else { return _mm512_cmpge_epi32_mask(x, v); }
+        }
+
+        template <compare_op Op>
+        SIMD_TARGET_AVX512 __mmask16 compare(__m512 x, __m512 v)
+        {
+            if constexpr (Op == compare_op::equal) { return _mm512_cmp_ps_mask(x, v, _CMP_EQ_OQ); }
+            else if constexpr (Op == compare_op::not_equal) { return _mm512_cmp_ps_mask(x, v, _CMP_NEQ_UQ); }
+            else if constexpr (Op == compare_op::less) { return _mm512_cmp_ps_mask(x, v, _CMP_LT_OQ); }
+            else if constexpr (Op == compare_op::less_equal) { return _mm512_cmp_ps_mask(x, v, _CMP_LE_OQ); }
+            else if constexpr (Op == compare_op::greater) { return _mm512_cmp_ps_mask(x, v, _CMP_GT_OQ); }
+            else { return _mm512_cmp_ps_mask(x, v, _CMP_GE_OQ); }
+        }
+
+        SIMD_TARGET_AVX512 inline __m512i min(__m512i a, __m512i b) { return _mm512_min_epi32(a, b); }
+        SIMD_TARGET_AVX512 inline __m512i max(__m512i a, __m512i b) { return _mm512_max_epi32(a, b); }
+        SIMD_TARGET_AVX512 inline __m512  min(__m512 a, __m512 b) { return _mm512_min_ps(a, b); }
+        SIMD_TARGET_AVX512 inline __m512  max(__m512 a, __m512 b) { return _mm512_max_ps(a, b); }
+
+        // std::clamp semantics (see sse2::clampLanes)
+        SIMD_TARGET_AVX512 inline __m512i clampLanes(__m512i x, __m512i lo, __m512i hi) { return min(max(x, lo), hi); }
+
+        SIMD_TARGET_AVX512 inline __m512 clampLanes(__m512 x, __m512 lo, __m512 hi)
+        {
+            const __m512 upper{ _mm512_mask_blend_ps(_mm512_cmp_ps_mask(hi, x, _CMP_LT_OQ), x, hi) };
+            return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, lo, _CMP_LT_OQ), upper, lo);
+        }
+
+        template <typename T, compare_op Op>
+        SIMD_TARGET_AVX512 std::size_t findIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                const unsigned int mask{ compare<Op>(load(data + i), v) };
+                if (mask != 0) {
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+
+            return i + scalar::findIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX512 std::size_t findLast(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+
+            std::size_t i{ size };
+            for (; i >= Lanes; i -= Lanes) {
+                const unsigned int mask{ compare<compare_op::equal>(load(data + i - Lanes), v) };
+                if (mask != 0) {
+                    return i - Lanes + static_cast<std::size_t>(std::bit_width(mask)) - 1;
+                }
+            }
+
+            const std::size_t pos{ scalar::findLast(data, i, value) };
+            return pos != i ? pos : size;
+        }
+
+        template <typename T, compare_op Op>
+        SIMD_TARGET_AVX512 std::size_t countIf(const T* data, std::size_t size, T value)
+        {
+            const auto v{ broadcast(value) };
+            const __m512i one{ _mm512_set1_epi32(1) };
+            __m512i counts{ _mm512_setzero_si512() };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                counts = _mm512_mask_add_epi32(counts, compare<Op>(load(data + i), v), counts, one);
+            }
+
+            std::array<std::uint32_t, Lanes> lanes{};
+            _mm512_storeu_si512(lanes.data(), counts);
+
+            std::size_t count{};
+            for (const std::uint32_t lane : lanes) {
+                count += lane;
+            }
+
+            return count + scalar::countIf<T, Op>(data + i, size - i, value);
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX512 std::pair<T, T> minMaxValues(const T* data, std::size_t size)
+        {
+            if (size < Lanes) {
+                return scalar::minMaxValues(data, size);
+            }
+
+            auto lo{ load(data) };
+            auto hi{ lo };
+
+            std::size_t i{ Lanes };
+            for (; i + Lanes <= size; i += Lanes) {
+                const auto x{ load(data + i) };
+                lo = min(lo, x);
+                hi = max(hi, x);
+            }
+
+            std::array<T, Lanes> los{}, his{};
+            store(los.data(), lo);
+            store(his.data(), hi);
+
+            T minValue{ std::ranges::min(los) };
+            T maxValue{ std::ranges::max(his) };
+            for (; i != size; ++i) {
+                minValue = std::min(minValue, data[i]);
+                maxValue = std::max(maxValue, data[i]);
+            }
+
+            return { minValue, maxValue };
+        }
+
+        template <typename T>
+        SIMD_TARGET_AVX512 void clamp(const T* data, std::size_t size, T lo, T hi, T* out)
+        {
+            const auto vlo{ broadcast(lo) };
+            const auto vhi{ broadcast(hi) };
+
+            std::size_t i{};
+            for (; i + Lanes <= size; i += Lanes) {
+                store(out + i, clampLanes(load(data + i), vlo, vhi));
+            }
+
+            scalar::clamp(data + i, size - i, lo, hi, out + i);
+        }
+    }
+
+#endif
+
+    // =======================================================================
+    // dispatching: instruction set at runtime, comparison at compile time
+
+    namespace details
+    {
+        template <typename TFunc>
+        decltype(auto) withCompareOp(compare_op op, TFunc&& func)
+        {
+            switch (op) {
+            case compare_op::equal:         return func.template operator()<compare_op::equal>();
+            case compare_op::not_equal:     return func.template operator()<compare_op::not_equal>();
+            case compare_op::less:          return func.template operator()<compare_op::less>();
+            case compare_op::less_equal:    return func.template operator()<compare_op::less_equal>();
+            case compare_op::greater:       return func.template operator()<compare_op::greater>();
+            case compare_op::greater_equal: return func.template operator()<compare_op::greater_equal>();
+            }
+            std::unreachable();
+        }
+
+        template <typename T>
+        std::size_t findIf(const T* data, std::size_t size, compare_with<T> pred)
+        {
+            return withCompareOp(pred.m_op, [&]<compare_op Op>() {
+                switch (currentSimdLevel()) {
+#if defined(SIMD_ALGORITHMS_X64)
+                case simd_level::avx512: return avx512::findIf<T, Op>(data, size, pred.m_value);
+                case simd_level::avx2:   return avx2::findIf<T, Op>(data, size, pred.m_value);
+                case simd_level::sse2:   return sse2::findIf<T, Op>(data, size, pred.m_value);
+#endif
+                default:                 return scalar::findIf<T, Op>(data, size, pred.m_value);
+                }
+            });
+        }
+
+        template <typename T>
+        std::size_t countIf(const T* data, std::size_t size, compare_with<T> pred)
+        {
+            return withCompareOp(pred.m_op, [&]<compare_op Op>() {
+                switch (currentSimdLevel()) {
+#if defined(SIMD_ALGORITHMS_X64)
+                case simd_level::avx512: return avx512::countIf<T, Op>(data, size, pred.m_value);
+                case simd_level::avx2:   return avx2::countIf<T, Op>(data, size, pred.m_value);
+                case simd_level::sse2:   return sse2::countIf<T, Op>(data, size, pred.m_value);
+#endif
+                default:                 return scalar::countIf<T, Op>(data, size, pred.m_value);
+                }
+            });
+        }
+
+        template <typename T>
+        std::size_t findLast(const T* data, std::size_t size, T value)
+        {
+            switch (currentSimdLevel()) {
+#if defined(SIMD_ALGORITHMS_X64)
+            case simd_level::avx512: return avx512::findLast(data, size, value);
+            case simd_level::avx2:   return avx2::findLast(data, size, value);
+            case simd_level::sse2:   return sse2::findLast(data, size, value);
+#endif
+            default:                 return scalar::findLast(data, size, value);
+            }
+        }
+
+        template <typename T>
+        std::pair<T, T> minMaxValues(const T* data, std::size_t size)
+        {
+            switch (currentSimdLevel()) {
+#if defined(SIMD_ALGORITHMS_X64)
+            case simd_level::avx512: return avx512::minMaxValues(data, size);
+            case simd_level::avx2:   return avx2::minMaxValues(data, size);
+            case simd_level::sse2:   return sse2::minMaxValues(data, size);
+#endif
+            default:                 return scalar::minMaxValues(data, size);
+            }
+        }
+
+        template <typename T>
+        void clamp(const T* data, std::size_t size, T lo, T hi, T* out)
+        {
+            switch (currentSimdLevel()) {
+#if defined(SIMD_ALGORITHMS_X64)
+            case simd_level::avx512: avx512::clamp(data, size, lo, hi, out); break;
+            case simd_level::avx2:   avx2::clamp(data, size, lo, hi, out); break;
+            case simd_level::sse2:   sse2::clamp(data, size, lo, hi, out); break;
+#endif
+            default:                 scalar::clamp(data, size, lo, hi, out); break;
+            }
+        }
+    }
+
+    // =======================================================================
+    // algorithms: contiguous ranges of int or float values use the kernels,
+    // all other ranges (and predicates) the std::ranges algorithms
+
+    template <typename T>
+    concept SimdArithmetic = std::same_as<T, int> || std::same_as<T, float>;
+
+    template <typename TRange>
+    concept SimdRange =
+        std::ranges::contiguous_range<TRange> &&
+        std::ranges::sized_range<TRange> &&
+        SimdArithmetic<std::ranges::range_value_t<TRange>>;
+
+    template <std::ranges::input_range TRange, typename TPred>
+    std::ranges::borrowed_iterator_t<TRange> simd_find_if(TRange&& range, TPred pred)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        if constexpr (SimdRange<TRange> && std::same_as<TPred, compare_with<ValueType>>) {
+            const std::size_t size{ std::ranges::size(range) };
+            const std::size_t pos{ details::findIf(std::ranges::data(range), size, pred) };
+            return std::ranges::begin(range) + static_cast<std::ptrdiff_t>(pos);
+        }
+        else {
+            return std::ranges::find_if(range, pred);
+        }
+    }
+
+    template <std::ranges::input_range TRange, typename T>
+    std::ranges::borrowed_iterator_t<TRange> simd_find(TRange&& range, const T& value)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        if constexpr (SimdRange<TRange> && std::same_as<T, ValueType>) {
+            return simd_find_if(std::forward<TRange>(range), pred::equal_to(value));
+        }
+        else {
+            return std::ranges::find(range, value);
+        }
+    }
+
+    template <std::ranges::input_range TRange, typename TPred>
+    std::ranges::range_difference_t<TRange> simd_count_if(TRange&& range, TPred pred)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        if constexpr (SimdRange<TRange> && std::same_as<TPred, compare_with<ValueType>>) {
+            const std::size_t size{ std::ranges::size(range) };
+            return static_cast<std::ranges::range_difference_t<TRange>>(
+                details::countIf(std::ranges::data(range), size, pred)
+            );
+        }
+        else {
+            return std::ranges::count_if(range, pred);
+        }
+    }
+
+    template <std::ranges::input_range TRange, typename T>
+    std::ranges::range_difference_t<TRange> simd_count(TRange&& range, const T& value)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        if constexpr (SimdRange<TRange> && std::same_as<T, ValueType>) {
+            return simd_count_if(range, pred::equal_to(value));
+        }
+        else {
+            return std::ranges::count(range, value);
+        }
+    }
+
+    // same result as std::ranges::minmax_element: first smallest, last largest element
+    template <std::ranges::forward_range TRange>
+    std::ranges::minmax_element_result<std::ranges::borrowed_iterator_t<TRange>> simd_minmax_element(TRange&& range)
+    {
+        if constexpr (SimdRange<TRange>) {
+            const auto first{ std::ranges::begin(range) };
+            const auto* data{ std::ranges::data(range) };
+            const std::size_t size{ std::ranges::size(range) };
+
+            if (size == 0) {
+                return { first, first };
+            }
+
+            using ValueType = std::ranges::range_value_t<TRange>;
+
+            // NaN isn't ordered: the result of std::ranges::minmax_element depends on
+            // the positions of the NaNs, the SIMD minimum / maximum would lose them.
+            // Every other value is >= -infinity
+            if constexpr (std::floating_point<ValueType>) {
+                const auto ordered{ pred::greater_equal(-std::numeric_limits<ValueType>::infinity()) };
+                if (details::countIf(data, size, ordered) != size) {
+                    return std::ranges::minmax_element(range);
+                }
+            }
+
+            // -0.0 and +0.0 are equivalent: findIf / findLast use ==,
+            // the first smallest and the last largest of them are found
+            const auto [minValue, maxValue] { details::minMaxValues(data, size) };
+            const std::size_t minPos{ details::findIf(data, size, pred::equal_to(minValue)) };
+            const std::size_t maxPos{ details::findLast(data, size, maxValue) };
+
+            return { first + static_cast<std::ptrdiff_t>(minPos), first + static_cast<std::ptrdiff_t>(maxPos) };
+        }
+        else {
+            return std::ranges::minmax_element(range);
+        }
+    }
+
+    // writes std::clamp(elem, lo, hi) for every element to result
+    template <std::ranges::input_range TRange, std::weakly_incrementable TOut, typename T>
+    TOut simd_clamp(TRange&& range, TOut result, const T& lo, const T& hi)
+    {
+        using ValueType = std::ranges::range_value_t<TRange>;
+
+        if constexpr (SimdRange<TRange> && std::same_as<T, ValueType> &&
+            std::contiguous_iterator<TOut> && std::same_as<std::iter_value_t<TOut>, ValueType>)
+        {
+            const std::size_t size{ std::ranges::size(range) };
+            details::clamp(std::ranges::data(range), size, lo, hi, std::to_address(result));
+            return result + static_cast<std::ptrdiff_t>(size);
+        }
+        else {
+            return std::ranges::transform(range, result, [&](const auto& elem) { return std::clamp(elem, lo, hi); }).out;
+        }
+    }
+
+    // =======================================================================
+    // examples
+
+    static void printRange(std::string_view msg, auto&& range)
+    {
+        std::print("{}", msg);
+
+        for (const auto& elem : range) {
+            std::print("{} ", elem);
+        }
+        std::println("");
+    }
+
+    static void simd_algorithms_01_introduction()
+    {
+        std::println("Instruction set: {}", toString(currentSimdLevel()));
+
+        auto values = std::vector{ 4, 3, 2, 3, 1, 6, 7, 8, 9, 10, 3, 12, 13, 14, 15, 16, 17, 3 };
+
+        auto it = simd_find(values, 2);
+        if (it != std::end(values)) {
+            std::println("Found {} at position {}", *it, std::distance(values.begin(), it));
+        }
+
+        std::println("Count of 3:  {}", simd_count(values, 3));
+        std::println("Greater 10:  {}", simd_count_if(values, pred::greater_than(10)));
+        std::println("Odd numbers: {}", simd_count_if(values, [](int n) { return n % 2 == 1; }));   // std::ranges::count_if
+
+        const auto [minIter, maxIter] = simd_minmax_element(values);
+        std::println("Min: {}, Max: {}", *minIter, *maxIter);
+
+        std::vector<int> clamped(values.size());
+        simd_clamp(values, clamped.begin(), 5, 10);
+        printRange("Clamped: ", clamped);
+
+        // other ranges use the std::ranges algorithms
+        auto list = std::list{ 4, 3, 2, 3, 1 };
+        std::println("Count of 3 in list: {}", simd_count(list, 3));
+    }
+
+    // =======================================================================
+    // differential tests: every kernel against the std::ranges algorithms
+
+    template <typename T>
+    static std::size_t compareWithStd(const std::vector<T>& values, T probe)
+    {
+        std::size_t failures{};
+
+        auto check = [&](bool ok, std::string_view what) {
+            if (!ok) {
+                ++failures;
+                std::println("  FAILED: {} (size {}, level {})", what, values.size(), toString(currentSimdLevel()));
+            }
+        };
+
+        check(simd_find(values, probe) == std::ranges::find(values, probe), "find");
+        check(simd_count(values, probe) == std::ranges::count(values, probe), "count");
+
+        for (compare_op op : { compare_op::equal, compare_op::not_equal, compare_op::less,
+                               compare_op::less_equal, compare_op::greater, compare_op::greater_equal })
+        {
+            const compare_with<T> pred{ op, probe };
+            check(simd_find_if(values, pred) == std::ranges::find_if(values, pred), "find_if");
+            check(simd_count_if(values, pred) == std::ranges::count_if(values, pred), "count_if");
+        }
+
+        const auto simdResult{ simd_minmax_element(values) };
+        const auto stdResult{ std::ranges::minmax_element(values) };
+        check(simdResult.min == stdResult.min && simdResult.max == stdResult.max, "minmax_element");
+
+        // bitwise comparison: NaN != NaN, -0.0 == +0.0
+        auto checkClamp = [&](T lo, T hi) {
+            std::vector<T> simdClamped(values.size()), stdClamped(values.size());
+            simd_clamp(values, simdClamped.begin(), lo, hi);
+            std::ranges::transform(values, stdClamped.begin(), [&](T elem) { return std::clamp(elem, lo, hi); });
+            check(values.empty() || std::memcmp(simdClamped.data(), stdClamped.data(), values.size() * sizeof(T)) == 0, "clamp");
+        };
+
+        checkClamp(static_cast<T>(probe - 3), static_cast<T>(probe + 3));
+
+        if constexpr (std::floating_point<T>) {
+            checkClamp(T{ -0.0 }, T{ 0.0 });
+            checkClamp(T{ 0.0 }, T{ 1.0 });
+        }
+
+        return failures;
+    }
+
+    static void simd_algorithms_02_differential_tests()
+    {
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> distribution{ -20, 20 };
+        std::uniform_int_distribution<int> special{ 0, 7 };
+
+        const simd_level supported{ supportedSimdLevel() };
+
+        for (auto level : { simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512 }) {
+
+            if (level > supported) {
+                continue;
+            }
+
+            setSimdLevel(level);
+
+            std::size_t checks{};
+            std::size_t failures{};
+
+            for (std::size_t size{}; size != 100; ++size) {
+                for (std::size_t repetition{}; repetition != 5; ++repetition) {
+
+                    std::vector<int> ints(size);
+                    std::vector<float> floats(size);
+                    for (std::size_t i{}; i != size; ++i) {
+                        ints[i] = distribution(generator);
+                        floats[i] = static_cast<float>(distribution(generator)) * 0.5f;
+                    }
+
+                    // repetition 3: -0.0 / +0.0 mixed in, repetition 4: NaN as well
+                    if (repetition >= 3) {
+                        for (std::size_t i{}; i != size; ++i) {
+                            switch (special(generator)) {
+                            case 0: floats[i] = -0.0f; break;
+                            case 1: floats[i] = 0.0f; break;
+                            case 2: if (repetition == 4) { floats[i] = std::numeric_limits<float>::quiet_NaN(); } break;
+                            default: break;
+                            }
+                        }
+                    }
+
+                    const int probe{ distribution(generator) };
+                    failures += compareWithStd(ints, probe);
+                    failures += compareWithStd(floats, static_cast<float>(probe) * 0.5f);
+                    checks += 2;
+                }
+            }
+
+            std::println("{:<8} {} test cases, {} failures", toString(level), checks, failures);
+        }
+
+        setSimdLevel(supported);
+    }
+
+    // =======================================================================
+    // benchmark
+
+    template <typename TFunc>
+    static void measure(std::string_view label, std::size_t bytes, TFunc func)
+    {
+        constexpr int Repetitions{ 10 };
+
+        const auto [checksum, elapsed] { Helpers::stopwatch([&] {
+            std::size_t sum{};
+            for (int i{}; i != Repetitions; ++i) {
+                sum += static_cast<std::size_t>(func());
+            }
+            return sum;
+        }) };
+
+        const double seconds{ std::chrono::duration<double>(elapsed).count() };
+        const double gigabytes{ static_cast<double>(bytes) * Repetitions / 1e9 };
+
+        std::println("  {:<28} {:>7.2f} GB/sec (checksum {})", label, gigabytes / seconds, checksum);
+    }
+
+    static void simd_algorithms_03_benchmark()
+    {
+        constexpr std::size_t Size{ 16'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> distribution{ 0, 1'000'000 };
+
+        std::vector<int> values(Size);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+
+        std::vector<int> clamped(Size);
+
+        const std::size_t bytes{ Size * sizeof(int) };
+        const simd_level supported{ supportedSimdLevel() };
+
+        std::println("{} ints:", Size);
+        std::println("std::ranges:");
+        measure("find (not found):", bytes, [&] { return std::ranges::find(values, -1) - values.begin(); });
+        measure("count:", bytes, [&] { return std::ranges::count(values, 42); });
+        measure("count_if (greater):", bytes, [&] { return std::ranges::count_if(values, [](int n) { return n > 500'000; }); });
+        measure("minmax_element:", bytes, [&] { return *std::ranges::minmax_element(values).max; });
+        measure("transform (clamp):", bytes, [&] {
+            std::ranges::transform(values, clamped.begin(), [](int n) { return std::clamp(n, 1'000, 999'000); });
+            return clamped[Size / 2];
+        });
+
+        for (auto level : { simd_level::scalar, simd_level::sse2, simd_level::avx2, simd_level::avx512 }) {
+
+            if (level > supported) {
+                continue;
+            }
+
+            setSimdLevel(level);
+
+            std::println("{}:", toString(level));
+            measure("simd_find (not found):", bytes, [&] { return simd_find(values, -1) - values.begin(); });
+            measure("simd_count:", bytes, [&] { return simd_count(values, 42); });
+            measure("simd_count_if (greater):", bytes, [&] { return simd_count_if(values, pred::greater_than(500'000)); });
+            measure("simd_minmax_element:", bytes, [&] { return *simd_minmax_element(values).max; });
+            measure("simd_clamp:", bytes, [&] {
+                simd_clamp(values, clamped.begin(), 1'000, 999'000);
+                return clamped[Size / 2];
+            });
+        }
+
+        setSimdLevel(supported);
+    }
+}
+
+void ranges_15_simd_algorithms()
+{
+    using namespace Cpp20RangesSimdAlgorithms;
+
+    simd_algorithms_01_introduction();
+    simd_algorithms_02_differential_tests();
+    simd_algorithms_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,394 @@
+// ===========================================================================
+// Ranges_16_PrefixScan.cpp
+// ===========================================================================
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesPrefixScan
+{
+    // =======================================================================
+    // partial_sum_view: lazy inclusive scan, the i-th element is the
+    // "sum" of the first i + 1 elements of the underlying range.
+    // The operation must be copyable (std::plus<>, std::multiplies<>,
+    // lambdas without captures, ...).
+
+    template<std::ranges::input_range V, std::copyable TOp>
+        requires std::ranges::view<V> &&
+            std::default_initializable<std::ranges::range_value_t<V>> &&
+            std::convertible_to<
+                std::invoke_result_t<TOp&, std::ranges::range_value_t<V>, std::ranges::range_reference_t<V>>,
+                std::ranges::range_value_t<V>
+            >
+    class partial_sum_view
+        : public std::ranges::view_interface<partial_sum_view<V, TOp>>
+    {
+    private:
+        using value_t = std::ranges::range_value_t<V>;
+
+        V   base_{};
+        TOp op_{};
+
+        // operator* returns the "sum" by value: a reference to a member of the
+        // iterator (stashing iterator) would violate the forward iterator
+        // requirements and would dangle together with the iterator.
+        // The underlying range is dereferenced only for elements that exist:
+        // neither the constructor nor end() touch it.
+        class iterator
+        {
+        private:
+            partial_sum_view*           parent_{};
+            std::ranges::iterator_t<V>  current_{};
+            std::optional<value_t>      sum_{};     // empty: first element, the "sum" is the element itself
+
+            constexpr bool atEnd() const { return current_ == std::ranges::end(parent_->base_); }
+
+        public:
+            using difference_type  = std::ranges::range_difference_t<V>;
+            using value_type       = value_t;
+            using iterator_concept = std::conditional_t<
+                std::ranges::forward_range<V>,
+                std::forward_iterator_tag,
+                std::input_iterator_tag
+            >;
+
+            iterator() = default;
+
+            constexpr iterator(partial_sum_view* parent, std::ranges::iterator_t<V> current)
+                : parent_{ parent }, current_{ std::move(current) }
+            {}
+
+            constexpr const std::ranges::iterator_t<V>& base() const& { return current_; }
+
+            constexpr value_t operator* () const
+            {
+                return sum_.has_value() ? *sum_ : static_cast<value_t>(*current_);
+            }
+
+            constexpr iterator& operator++ ()
+            {
+                value_t sum{ **this };
+                ++current_;
+                if (!atEnd()) {
+                    sum_ = std::invoke(parent_->op_, std::move(sum), *current_);
+                }
+                return *this;
+            }
+
+            constexpr void operator++ (int) requires (!std::ranges::forward_range<V>) { ++*this; }
+
+            constexpr iterator operator++ (int) requires std::ranges::forward_range<V>
+            {
+                auto tmp{ *this };
+                ++*this;
+                return tmp;
+            }
+
+            friend constexpr bool operator== (const iterator& lhs, const iterator& rhs)
+                requires std::equality_comparable<std::ranges::iterator_t<V>>
+            {
+                return lhs.current_ == rhs.current_;
+            }
+
+            friend constexpr bool operator== (const iterator& it, std::default_sentinel_t)
+            {
+                return it.atEnd();
+            }
+        };
+
+    public:
+        partial_sum_view() = default;
+
+        constexpr explicit partial_sum_view(V base, TOp op)
+            : base_{ std::move(base) }, op_{ std::move(op) }
+        {}
+
+        constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+        constexpr V base()&& { return std::move(base_); }
+
+        constexpr auto begin() { return iterator{ this, std::ranges::begin(base_) }; }
+
+        constexpr auto end()
+        {
+            if constexpr (std::ranges::common_range<V> && std::ranges::forward_range<V>) {
+                return iterator{ this, std::ranges::end(base_) };
+            }
+            else {
+                return std::default_sentinel;
+            }
+        }
+
+        constexpr auto size() requires std::ranges::sized_range<V>
+        {
+            return std::ranges::size(base_);
+        }
+    };
+
+    template<class R, class TOp>
+    partial_sum_view(R&&, TOp) -> partial_sum_view<std::ranges::views::all_t<R>, TOp>;
+
+    namespace details
+    {
+        template <typename TOp>
+        struct partial_sum_closure
+        {
+            TOp op_;
+        };
+
+        struct partial_sum_range_adaptor
+        {
+            template <std::ranges::viewable_range R>
+            constexpr auto operator () (R&& r) const
+            {
+                return partial_sum_view{ std::forward<R>(r), std::plus<>{} };
+            }
+
+            template <std::ranges::viewable_range R, typename TOp>
+            constexpr auto operator () (R&& r, TOp op) const
+            {
+                return partial_sum_view{ std::forward<R>(r), std::move(op) };
+            }
+
+            template <typename TOp>
+                requires (!std::ranges::range<TOp>)
+            constexpr auto operator () (TOp op) const
+            {
+                return partial_sum_closure<TOp>{ std::move(op) };
+            }
+        };
+
+        template <std::ranges::viewable_range R>
+        constexpr auto operator | (R&& r, const partial_sum_range_adaptor& a)
+        {
+            return a(std::forward<R>(r));
+        }
+
+        template <std::ranges::viewable_range R, typename TOp>
+        constexpr auto operator | (R&& r, const partial_sum_closure<TOp>& c)
+        {
+            return partial_sum_view{ std::forward<R>(r), c.op_ };
+        }
+    }
+
+    // =======================================================================
+    // parallel_inclusive_scan / parallel_exclusive_scan: two-pass blocked
+    // algorithm for contiguous ranges and associative operations
+    //
+    // pass 1: every thread reduces its block, the block results are scanned
+    //         sequentially (one value per thread),
+    // pass 2: every thread scans its block, starting with the offset of
+    //         the block.
+    //
+    // The input is read twice and the output written once, the output may
+    // be the input itself (in-place scan).
+
+    namespace details
+    {
+        using Helpers::parallelFor;
+        using Helpers::numberOfThreads;
+
+        template <bool Inclusive, typename TIn, typename TOut, typename T, typename TOp>
+        TOut blockedScan(const TIn* data, std::size_t size, TOut result, std::optional<T> init, TOp op)
+        {
+            if (size == 0) {
+                return result;
+            }
+
+            const std::size_t threads{ numberOfThreads(size) };
+            auto blockBegin = [&](std::size_t index) { return size * index / threads; };
+
+            // pass 1: reduce every block (except the last one)
+            std::vector<std::optional<T>> offsets(threads);
+
+            if (threads > 1) {
+                parallelFor(threads - 1, [&](std::size_t index) {
+                    T sum = data[blockBegin(index)];
+                    for (std::size_t i{ blockBegin(index) + 1 }; i != blockBegin(index + 1); ++i) {
+                        sum = op(std::move(sum), data[i]);
+                    }
+                    offsets[index + 1] = std::move(sum);
+                });
+            }
+
+            // offset of block k: init "+" sum of all blocks before k
+            offsets[0] = init;
+            for (std::size_t index{ 1 }; index < threads; ++index) {
+                if (offsets[index - 1]) {
+                    offsets[index] = op(*offsets[index - 1], *offsets[index]);
+                }
+            }
+
+            // pass 2: scan every block
+            parallelFor(threads, [&](std::size_t index) {
+                const std::size_t first{ blockBegin(index) };
+                const std::size_t last{ blockBegin(index + 1) };
+
+                if constexpr (Inclusive) {
+                    T sum = offsets[index] ? op(*offsets[index], data[first]) : T(data[first]);
+                    result[first] = sum;
+                    for (std::size_t i{ first + 1 }; i != last; ++i) {
+                        sum = op(std::move(sum), data[i]);
+                        result[i] = sum;
+                    }
+                }
+                else {
+                    T sum = *offsets[index];
+                    for (std::size_t i{ first }; i != last; ++i) {
+                        T next = op(sum, data[i]);      // read before write: in-place scan
+                        result[i] = std::move(sum);
+                        sum = std::move(next);
+                    }
+                }
+            });
+
+            return result + static_cast<std::ptrdiff_t>(size);
+        }
+    }
+
+    template <std::ranges::contiguous_range TRange, std::random_access_iterator TOut, typename TOp = std::plus<>>
+        requires std::ranges::sized_range<TRange>
+    TOut parallel_inclusive_scan(TRange&& range, TOut result, TOp op = {})
+    {
+        using T = std::ranges::range_value_t<TRange>;
+
+        return details::blockedScan<true>(
+            std::ranges::data(range), std::ranges::size(range), result, std::optional<T>{}, op
+        );
+    }
+
+    template <std::ranges::contiguous_range TRange, std::random_access_iterator TOut, typename T, typename TOp = std::plus<>>
+        requires std::ranges::sized_range<TRange>
+    TOut parallel_exclusive_scan(TRange&& range, TOut result, T init, TOp op = {})
+    {
+        return details::blockedScan<false>(
+            std::ranges::data(range), std::ranges::size(range), result, std::optional<T>{ init }, op
+        );
+    }
+}
+
+namespace views
+{
+    inline Cpp20RangesPrefixScan::details::partial_sum_range_adaptor partial_sum;
+}
+
+// ===========================================================================
+// ===========================================================================
+
+namespace Cpp20RangesPrefixScan
+{
+    // =======================================================================
+    // examples
+
+    static void printRange(std::string_view msg, auto&& range)
+    {
+        std::print("{}", msg);
+
+        for (const auto& elem : range) {
+            std::print("{} ", elem);
+        }
+        std::println("");
+    }
+
+    static void prefix_scan_01_views()
+    {
+        // sensor delivers time differences, we need absolute timestamps
+        auto deltas = std::vector<long long>{ 1000, 15, 20, 5, 40, 10, 25 };
+        printRange("Timestamps: ", deltas | views::partial_sum);
+
+        // other operations
+        printRange("Factorials: ", std::views::iota(1LL, 11LL) | views::partial_sum(std::multiplies<>{}));
+        printRange("Maximum:    ", std::vector{ 3, 1, 4, 1, 5, 9, 2, 6 } | views::partial_sum([](int a, int b) { return std::max(a, b); }));
+
+        // lazy: works with infinite ranges
+        auto triangular = std::views::iota(1)
+            | views::partial_sum
+            | std::views::take_while([](int n) { return n < 100; });
+
+        printRange("Triangular: ", triangular);
+    }
+
+    static void prefix_scan_02_parallel_scans()
+    {
+        auto values = std::vector{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+        std::vector<int> sums(values.size());
+        parallel_inclusive_scan(values, sums.begin());
+        printRange("Inclusive: ", sums);
+
+        // histogram counts to bucket offsets
+        auto counts = std::vector<std::size_t>{ 3, 0, 5, 2, 7, 1 };
+        std::vector<std::size_t> offsets(counts.size());
+        parallel_exclusive_scan(counts, offsets.begin(), std::size_t{});
+        printRange("Offsets:   ", offsets);
+
+        // in place
+        parallel_inclusive_scan(values, values.begin(), std::multiplies<>{});
+        printRange("Products:  ", values);
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    static void prefix_scan_03_benchmark()
+    {
+        constexpr std::size_t Size{ 50'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<std::int64_t> distribution{ 0, 1'000 };
+
+        std::vector<std::int64_t> values(Size);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+
+        std::vector<std::int64_t> sums(Size);
+
+        std::println("{} values, {} threads:", Size, std::thread::hardware_concurrency());
+
+        measure("std::partial_sum:", [&] {
+            std::partial_sum(values.begin(), values.end(), sums.begin());
+            return sums.back();
+        });
+
+        measure("std::inclusive_scan:", [&] {
+            std::inclusive_scan(values.begin(), values.end(), sums.begin());
+            return sums.back();
+        });
+
+        measure("views::partial_sum | copy:", [&] {
+            std::ranges::copy(values | views::partial_sum, sums.begin());
+            return sums.back();
+        });
+
+        measure("parallel_inclusive_scan:", [&] {
+            parallel_inclusive_scan(values, sums.begin());
+            return sums.back();
+        });
+
+        measure("std::exclusive_scan:", [&] {
+            std::exclusive_scan(values.begin(), values.end(), sums.begin(), std::int64_t{});
+            return sums.back();
+        });
+
+        measure("parallel_exclusive_scan:", [&] {
+            parallel_exclusive_scan(values, sums.begin(), std::int64_t{});
+            return sums.back();
+        });
+    }
+}
+
+void ranges_16_prefix_scan()
+{
+    using namespace Cpp20RangesPrefixScan;
+
+    prefix_scan_01_views();
+    prefix_scan_02_parallel_scans();
+    prefix_scan_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,364 @@
+// ===========================================================================
+// Ranges_17_BinaryConversion.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BINARY_CONVERSION_SSE2
+#include <immintrin.h>
+#endif
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesBinaryConversion
+{
+    // =======================================================================
+    // conversion of a sequence of binary digits (most significant digit
+    // first, one std::uint8_t per digit) into 64-bit words
+    //
+    // 64 digits are exactly one word: the digits are compared with zero in
+    // SIMD registers, movemask collects one bit per digit (16 digits with
+    // SSE2, 32 with AVX2, 64 with AVX-512BW). Movemask puts the first digit
+    // into bit 0, the first digit is the most significant one: the bits of
+    // the word are reversed once per 64 digits.
+
+    // words of a binary number, least significant word first
+    using words_t = std::vector<std::uint64_t>;
+
+    constexpr std::uint64_t reverseBits(std::uint64_t x)
+    {
+        x = std::byteswap(x);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((x & 0x0F0F0F0F0F0F0F0Full) << 4);
+        x = ((x >> 2) & 0x3333333333333333ull) | ((x & 0x3333333333333333ull) << 2);
+        x = ((x >> 1) & 0x5555555555555555ull) | ((x & 0x5555555555555555ull) << 1);
+        return x;
+    }
+
+    namespace details
+    {
+        // up to 64 digits, scalar: one shift per digit
+        inline std::uint64_t packScalar(const std::uint8_t* digits, std::size_t count, std::uint8_t& invalid)
+        {
+            std::uint64_t word{};
+            for (std::size_t i{}; i != count; ++i) {
+                invalid |= digits[i] & 0xFE;
+                word = (word << 1) | (digits[i] & 1);
+            }
+            return word;
+        }
+
+        // exactly 64 digits
+        inline std::uint64_t pack64(const std::uint8_t* digits, std::uint8_t& invalid)
+        {
+#if defined(__AVX512BW__)
+            const __m512i x{ _mm512_loadu_si512(digits) };
+            const std::uint64_t mask{ _mm512_test_epi8_mask(x, x) };
+            invalid |= static_cast<std::uint8_t>(_mm512_test_epi8_mask(x, _mm512_set1_epi8(static_cast<char>(0xFE))) != 0);
+            return reverseBits(mask);
+#elif defined(__AVX2__)
+            const __m256i zero{ _mm256_setzero_si256() };
+            const __m256i high{ _mm256_set1_epi8(static_cast<char>(0xFE)) };
+
+            std::uint64_t mask{};
+            __m256i bad{ zero };
+            for (std::size_t i{}; i != 2; ++i) {
+                const __m256i x{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(digits + 32 * i)) };
+                const auto zeros{ static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, zero))) };
+                mask |= static_cast<std::uint64_t>(~zeros) << (32 * i);
+                bad = _mm256_or_si256(bad, _mm256_and_si256(x, high));
+            }
+            invalid |= static_cast<std::uint8_t>(!_mm256_testz_si256(bad, bad));
+            return reverseBits(mask);
+#elif defined(BINARY_CONVERSION_SSE2)
+            const __m128i zero{ _mm_setzero_si128() };
+            const __m128i high{ _mm_set1_epi8(static_cast<char>(0xFE)) };
+
+            std::uint64_t mask{};
+            __m128i bad{ zero };
+            for (std::size_t i{}; i != 4; ++i) {
+                const __m128i x{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + 16 * i)) };
+                const auto zeros{ static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero))) };
+                mask |= static_cast<std::uint64_t>(~zeros & 0xFFFF) << (16 * i);
+                bad = _mm_or_si128(bad, _mm_and_si128(x, high));
+            }
+            invalid |= static_cast<std::uint8_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bad, zero)) != 0xFFFF);
+            return reverseBits(mask);
+#else
+            return packScalar(digits, 64, invalid);
+#endif
+        }
+
+        inline words_t pack(const std::uint8_t* digits, std::size_t size)
+        {
+            words_t words((size + 63) / 64);
+            std::uint8_t invalid{};
+
+            // the last 64 digits form the least significant word
+            std::size_t end{ size };
+            for (std::size_t i{}; end >= 64; ++i, end -= 64) {
+                words[i] = pack64(digits + end - 64, invalid);
+            }
+
+            if (end != 0) {
+                words.back() = packScalar(digits, end, invalid);
+            }
+
+            if (invalid != 0) {
+                throw std::invalid_argument{ "binary digits must be 0 or 1" };
+            }
+
+            // normalize: no leading zero words
+            while (!words.empty() && words.back() == 0) {
+                words.pop_back();
+            }
+
+            return words;
+        }
+
+        template <std::ranges::input_range TRange>
+        words_t pack(TRange&& digits)
+        {
+            using ValueType = std::ranges::range_value_t<TRange>;
+
+            if constexpr (std::ranges::contiguous_range<TRange> && std::ranges::sized_range<TRange> &&
+                std::same_as<ValueType, std::uint8_t>)
+            {
+                return pack(std::ranges::data(digits), std::ranges::size(digits));
+            }
+            else {
+                std::vector<std::uint8_t> buffer{};
+                for (auto&& digit : digits) {
+                    // validate before narrowing: 256 must not become 0
+                    if (digit != 0 && digit != 1) {
+                        throw std::invalid_argument{ "binary digits must be 0 or 1" };
+                    }
+                    buffer.push_back(static_cast<std::uint8_t>(digit));
+                }
+                return pack(buffer.data(), buffer.size());
+            }
+        }
+    }
+
+    // =======================================================================
+    // big_unsigned: arbitrary-length unsigned integer (just enough for
+    // the results of the conversion)
+
+    class big_unsigned
+    {
+    private:
+        words_t m_words;    // least significant word first, no leading zero words
+
+    public:
+        big_unsigned() = default;
+
+        explicit big_unsigned(words_t words) : m_words{ std::move(words) }
+        {
+            while (!m_words.empty() && m_words.back() == 0) {
+                m_words.pop_back();
+            }
+        }
+
+        std::span<const std::uint64_t> words() const { return m_words; }
+
+        std::size_t bit_width() const
+        {
+            return m_words.empty() ? 0 : 64 * (m_words.size() - 1) + std::bit_width(m_words.back());
+        }
+
+        std::string toHexString() const
+        {
+            if (m_words.empty()) {
+                return "0";
+            }
+
+            std::string result{ std::format("{:x}", m_words.back()) };
+            for (std::size_t i{ m_words.size() - 1 }; i != 0; --i) {
+                result += std::format("{:016x}", m_words[i - 1]);
+            }
+            return result;
+        }
+
+        // repeated division by 10^9 on 32-bit halves, no 128-bit arithmetic needed
+        std::string toString() const
+        {
+            constexpr std::uint64_t Base{ 1'000'000'000 };
+
+            std::vector<std::uint32_t> limbs{};     // most significant limb first
+            for (std::size_t i{ m_words.size() }; i != 0; --i) {
+                limbs.push_back(static_cast<std::uint32_t>(m_words[i - 1] >> 32));
+                limbs.push_back(static_cast<std::uint32_t>(m_words[i - 1]));
+            }
+
+            std::vector<std::uint32_t> chunks{};    // base 10^9, least significant chunk first
+
+            std::size_t first{};
+            while (first != limbs.size()) {
+                std::uint64_t remainder{};
+                for (std::size_t i{ first }; i != limbs.size(); ++i) {
+                    const std::uint64_t current{ (remainder << 32) | limbs[i] };
+                    limbs[i] = static_cast<std::uint32_t>(current / Base);
+                    remainder = current % Base;
+                }
+                chunks.push_back(static_cast<std::uint32_t>(remainder));
+
+                while (first != limbs.size() && limbs[first] == 0) {
+                    ++first;
+                }
+            }
+
+            if (chunks.empty()) {
+                return "0";
+            }
+
+            std::string result{ std::format("{}", chunks.back()) };
+            for (std::size_t i{ chunks.size() - 1 }; i != 0; --i) {
+                result += std::format("{:09}", chunks[i - 1]);
+            }
+            return result;
+        }
+
+        friend bool operator== (const big_unsigned&, const big_unsigned&) = default;
+    };
+
+    // =======================================================================
+    // conversion functions
+
+    // arbitrary length
+    template <std::ranges::input_range TRange>
+        requires std::integral<std::ranges::range_value_t<TRange>>
+    big_unsigned binary_to_big(TRange&& digits)
+    {
+        return big_unsigned{ details::pack(std::forward<TRange>(digits)) };
+    }
+
+    // fixed width: leading zeros are allowed, std::overflow_error otherwise
+    template <std::unsigned_integral T = std::uint64_t, std::ranges::input_range TRange>
+        requires std::integral<std::ranges::range_value_t<TRange>>
+    T binary_to_integer(TRange&& digits)
+    {
+        const words_t words{ details::pack(std::forward<TRange>(digits)) };
+
+        if (words.empty()) {
+            return T{};
+        }
+
+        if (words.size() > 1 || std::bit_width(words[0]) > std::numeric_limits<T>::digits) {
+            throw std::overflow_error{ "binary number too large for the target type" };
+        }
+
+        return static_cast<T>(words[0]);
+    }
+
+    // =======================================================================
+    // examples
+
+    static void binary_conversion_01_introduction()
+    {
+        // Ranges_06_RealworldExamples.cpp: inner_product with powers of 2
+        auto digits = std::vector<std::uint8_t>{ 1, 1, 1, 0 };
+        std::println("Value: {}", binary_to_integer(digits));
+
+        // more than 31 digits
+        auto digits40 = std::vector<std::uint8_t>(40, 1);
+        std::println("40 digits: {}", binary_to_integer(digits40));
+
+        // fixed width
+        std::println("uint8_t:   {}", binary_to_integer<std::uint8_t>(std::vector<std::uint8_t>{ 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 }));
+
+        try {
+            binary_to_integer<std::uint8_t>(std::vector<std::uint8_t>{ 1, 0, 0, 0, 0, 0, 0, 0, 0 });
+        }
+        catch (const std::overflow_error& e) {
+            std::println("Exception: {}", e.what());
+        }
+
+        // arbitrary length: 2^100 - 1
+        auto digits100 = std::vector<std::uint8_t>(100, 1);
+        big_unsigned value{ binary_to_big(digits100) };
+        std::println("2^100 - 1 = {} (0x{}, {} bits)", value.toString(), value.toHexString(), value.bit_width());
+
+        // any range of integral digits, e.g. characters '0' and '1'
+        std::string_view text{ "1011001110001111" };
+        auto fromText = text | std::views::transform([](char ch) { return static_cast<std::uint8_t>(ch - '0'); });
+        std::println("{} = {}", text, binary_to_integer(fromText));
+
+        // digits of a wider type are checked before they are narrowed
+        try {
+            binary_to_integer(std::vector<int>{ 1, 0, 256 });
+        }
+        catch (const std::invalid_argument& e) {
+            std::println("Exception: {}", e.what());
+        }
+    }
+
+    // =======================================================================
+    // benchmark
+
+    template <typename TFunc>
+    static void measure(std::string_view label, std::size_t bytes, TFunc func)
+    {
+        const auto [checksum, elapsed] { Helpers::stopwatch(func) };
+
+        const auto msecs{ std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() };
+        const double seconds{ std::chrono::duration<double>(elapsed).count() };
+
+        std::println("{:<28} {:>6} msecs {:>7.2f} GB/sec (checksum {})",
+            label, msecs, static_cast<double>(bytes) / 1e9 / seconds, checksum);
+    }
+
+    static std::uint64_t checksum(std::span<const std::uint64_t> words)
+    {
+        std::uint64_t result{};
+        for (const std::uint64_t word : words) {
+            result = result * 31 + word;
+        }
+        return result;
+    }
+
+    static void binary_conversion_02_benchmark()
+    {
+        constexpr std::size_t Digits{ 100'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::bernoulli_distribution distribution{ 0.5 };
+
+        std::vector<std::uint8_t> digits(Digits);
+        for (auto& digit : digits) {
+            digit = distribution(generator) ? 1 : 0;
+        }
+
+        std::println("{} binary digits:", Digits);
+
+        measure("shift per digit:", Digits, [&] {
+            words_t words((Digits + 63) / 64);
+            std::size_t end{ Digits };
+            for (std::size_t i{}; i != words.size(); ++i) {
+                const std::size_t begin{ end >= 64 ? end - 64 : 0 };
+                std::uint64_t word{};
+                for (std::size_t k{ begin }; k != end; ++k) {
+                    word = (word << 1) | digits[k];
+                }
+                words[i] = word;
+                end = begin;
+            }
+            return checksum(big_unsigned{ std::move(words) }.words());
+        });
+
+        measure("binary_to_big:", Digits, [&] {
+            return checksum(binary_to_big(digits).words());
+        });
+    }
+}
+
+void ranges_17_binary_conversion()
+{
+    using namespace Cpp20RangesBinaryConversion;
+
+    binary_conversion_01_introduction();
+    binary_conversion_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
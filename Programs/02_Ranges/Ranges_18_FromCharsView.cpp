@@ -0,0 +1,382 @@
+// ===========================================================================
+// Ranges_18_FromCharsView.cpp
+// ===========================================================================
+
+#include <cstdio>
+
+import std;
+
+#include "Helpers.h"
+
+namespace Cpp20RangesFromCharsView
+{
+    // =======================================================================
+    // from_chars_view: reads numbers separated by whitespace, comparable to
+    // std::ranges::istream_view. The characters are read block by block with
+    // std::fread (FILE*) or std::streambuf::sgetn (std::istream) and parsed
+    // with std::from_chars - no sentry, no locale, no virtual call per element.
+    // A number at the end of a block is moved to the beginning of the buffer
+    // before the next block is read.
+    //
+    // Grammar of a number (std::from_chars, decimal):
+    //   * an optional sign: '-', or '+' - a leading '+' is skipped here,
+    //     std::from_chars itself rejects it (operator>> accepts it)
+    //   * integral types: decimal digits - no "0x" prefix, no digit grouping
+    //   * floating point types: fixed or scientific notation, no hexadecimal
+    //     notation. Additionally "inf", "infinity" and "nan" (case insensitive)
+    //     are accepted - operator>> of the common implementations rejects them
+
+    template <typename T>
+        requires std::integral<T> || std::floating_point<T>
+    class from_chars_view
+        : public std::ranges::view_interface<from_chars_view<T>>
+    {
+    private:
+        static constexpr std::size_t DefaultBlockSize{ 64 * 1024 };
+
+        std::FILE*         file_{};
+        std::istream*      stream_{};
+        std::vector<char>  buffer_{};
+        std::size_t        first_{};     // unparsed characters: [first_, last_)
+        std::size_t        last_{};
+        bool               eof_{};       // source exhausted
+        bool               done_{};      // no more numbers
+        T                  value_{};
+
+        class iterator
+        {
+        private:
+            from_chars_view* parent_{};
+
+            bool atEnd() const { return parent_->done_; }
+
+        public:
+            using difference_type  = std::ptrdiff_t;
+            using value_type       = T;
+            using iterator_concept = std::input_iterator_tag;
+
+            iterator() = default;
+
+            explicit iterator(from_chars_view* parent) : parent_{ parent } {}
+
+            iterator(iterator&&) = default;
+            iterator& operator= (iterator&&) = default;
+
+            const T& operator* () const { return parent_->value_; }
+
+            iterator& operator++ ()
+            {
+                parent_->next();
+                return *this;
+            }
+
+            void operator++ (int) { ++*this; }
+
+            friend bool operator== (const iterator& it, std::default_sentinel_t)
+            {
+                return it.atEnd();
+            }
+        };
+
+    public:
+        explicit from_chars_view(std::FILE* file, std::size_t blockSize = DefaultBlockSize)
+            : file_{ file }, buffer_(std::max(blockSize, std::size_t{ 1 }))
+        {}
+
+        explicit from_chars_view(std::istream& stream, std::size_t blockSize = DefaultBlockSize)
+            : stream_{ &stream }, buffer_(std::max(blockSize, std::size_t{ 1 }))
+        {}
+
+        from_chars_view(from_chars_view&&) = default;
+        from_chars_view& operator= (from_chars_view&&) = default;
+
+        auto begin()
+        {
+            next();
+            return iterator{ this };
+        }
+
+        auto end() const { return std::default_sentinel; }
+
+    private:
+        static bool isSpace(char ch)
+        {
+            return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f';
+        }
+
+        std::size_t read(char* dest, std::size_t count)
+        {
+            if (file_ != nullptr) {
+                return std::fread(dest, 1, count, file_);
+            }
+            else {
+                return static_cast<std::size_t>(stream_->rdbuf()->sgetn(dest, static_cast<std::streamsize>(count)));
+            }
+        }
+
+        // keeps the unparsed characters, appends the next block
+        bool refill()
+        {
+            if (eof_) {
+                return false;
+            }
+
+            std::copy(buffer_.begin() + first_, buffer_.begin() + last_, buffer_.begin());
+            last_ -= first_;
+            first_ = 0;
+
+            // a single number fills the whole buffer
+            if (last_ == buffer_.size()) {
+                buffer_.resize(2 * buffer_.size());
+            }
+
+            const std::size_t count{ read(buffer_.data() + last_, buffer_.size() - last_) };
+            if (count == 0) {
+                eof_ = true;
+                return false;
+            }
+
+            last_ += count;
+            return true;
+        }
+
+        void next()
+        {
+            // skip whitespace
+            while (true) {
+                while (first_ != last_ && isSpace(buffer_[first_])) {
+                    ++first_;
+                }
+
+                if (first_ != last_) {
+                    break;
+                }
+
+                if (!refill()) {
+                    done_ = true;
+                    return;
+                }
+            }
+
+            // end of the number, it may continue in the next block
+            std::size_t end{ first_ };
+            while (true) {
+                while (end != last_ && !isSpace(buffer_[end])) {
+                    ++end;
+                }
+
+                if (end != last_) {
+                    break;
+                }
+
+                // refill moves the number to the beginning of the buffer
+                const std::size_t scanned{ end - first_ };
+                const bool more{ refill() };
+                end = first_ + scanned;
+
+                if (!more) {
+                    break;
+                }
+            }
+
+            const char* begin{ buffer_.data() + first_ };
+            const char* stop{ buffer_.data() + end };
+
+            // "+5" as with operator>> - but not "+-5"
+            const char* number{ begin };
+            if (stop - number > 1 && number[0] == '+' && number[1] != '-') {
+                ++number;
+            }
+
+            const auto [ptr, ec] { std::from_chars(number, stop, value_) };
+
+            if (ec == std::errc::result_out_of_range) {
+                throw std::out_of_range{ std::format("from_chars_view: '{}' out of range", std::string_view{ begin, stop }) };
+            }
+
+            if (ec != std::errc{} || ptr != stop) {
+                throw std::invalid_argument{ std::format("from_chars_view: invalid number '{}'", std::string_view{ begin, stop }) };
+            }
+
+            first_ = end;
+        }
+    };
+
+    namespace details
+    {
+        template <typename T>
+        struct from_chars_factory
+        {
+            auto operator () (std::FILE* file, std::size_t blockSize = 64 * 1024) const
+            {
+                return from_chars_view<T>{ file, blockSize };
+            }
+
+            auto operator () (std::istream& stream, std::size_t blockSize = 64 * 1024) const
+            {
+                return from_chars_view<T>{ stream, blockSize };
+            }
+        };
+    }
+}
+
+namespace views
+{
+    template <typename T>
+    inline constexpr Cpp20RangesFromCharsView::details::from_chars_factory<T> from_chars{};
+}
+
+// ===========================================================================
+// ===========================================================================
+
+namespace Cpp20RangesFromCharsView
+{
+    static std::FILE* openFile(const std::filesystem::path& path)
+    {
+#if defined(_MSC_VER)
+        std::FILE* file{};
+        return ::_wfopen_s(&file, path.c_str(), L"rb") == 0 ? file : nullptr;
+#else
+        return std::fopen(path.c_str(), "rb");
+#endif
+    }
+
+    static void from_chars_view_01_introduction()
+    {
+        // Ranges_02_Ranges_View.cpp: std::ranges::istream_view<int>{ std::cin }
+        std::istringstream input{ "1 2 +3\n4\t-5 6 7 8 9" };
+
+        auto view = views::from_chars<int>(input)
+            | std::ranges::views::take_while([](const auto& v) { return v < 5; })
+            | std::ranges::views::transform([](const auto& v) { return v * 2; });
+
+        for (auto value : view) {
+            std::print("{} ", value);
+        }
+        std::println("");
+
+        // a tiny block size: nearly every number is split across blocks
+        std::istringstream doubles{ "3.14159 2.71828   1e10 -0.5 123456789.125 +inf" };
+
+        for (double value : views::from_chars<double>(doubles, 4)) {
+            std::print("{} ", value);
+        }
+        std::println("");
+
+        // invalid input
+        std::istringstream invalid{ "10 20 3x0 40" };
+
+        try {
+            for (int value : views::from_chars<int>(invalid)) {
+                std::print("{} ", value);
+            }
+        }
+        catch (const std::invalid_argument& e) {
+            std::println("");
+            std::println("Exception: {}", e.what());
+        }
+    }
+
+    static void from_chars_view_02_file()
+    {
+        const std::filesystem::path path{ std::filesystem::temp_directory_path() / "from_chars_view_02.txt" };
+
+        {
+            std::ofstream out{ path };
+            for (int i{ 1 }; i <= 20; ++i) {
+                out << i * i << (i % 5 == 0 ? '\n' : ' ');
+            }
+        }
+
+        if (std::FILE* file{ openFile(path) }; file != nullptr) {
+
+            auto squares = views::from_chars<long>(file, 16)
+                | std::ranges::views::filter([](long n) { return n % 2 == 1; });
+
+            for (long value : squares) {
+                std::print("{} ", value);
+            }
+            std::println("");
+
+            std::fclose(file);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    // =======================================================================
+    // benchmark
+
+    using Helpers::measure;
+
+    static void from_chars_view_03_benchmark()
+    {
+        constexpr std::size_t Count{ 10'000'000 };
+
+        const std::filesystem::path path{ std::filesystem::temp_directory_path() / "from_chars_view_03.txt" };
+
+        // text dump: one number per line
+        {
+            std::mt19937 generator{ 1 };
+            std::uniform_int_distribution<int> distribution{ -1'000'000'000, 1'000'000'000 };
+
+            std::string text{};
+            std::array<char, 16> digits{};
+
+            for (std::size_t i{}; i != Count; ++i) {
+                const auto [ptr, ec] { std::to_chars(digits.data(), digits.data() + digits.size(), distribution(generator)) };
+                text.append(digits.data(), ptr);
+                text.push_back('\n');
+            }
+
+            std::ofstream out{ path, std::ios::binary };
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+
+        std::println("{} numbers:", Count);
+
+        measure("std::ranges::istream_view<int>:", [&] {
+            std::ifstream in{ path, std::ios::binary };
+            long long sum{};
+            for (int value : std::ranges::istream_view<int>{ in }) {
+                sum += value;
+            }
+            return sum;
+        });
+
+        measure("from_chars_view<int> (std::istream):", [&] {
+            std::ifstream in{ path, std::ios::binary };
+            long long sum{};
+            for (int value : views::from_chars<int>(in)) {
+                sum += value;
+            }
+            return sum;
+        });
+
+        measure("from_chars_view<int> (FILE*):", [&] {
+            long long sum{};
+            if (std::FILE* file{ openFile(path) }; file != nullptr) {
+                for (int value : views::from_chars<int>(file)) {
+                    sum += value;
+                }
+                std::fclose(file);
+            }
+            return sum;
+        });
+
+        std::filesystem::remove(path);
+    }
+}
+
+void ranges_18_from_chars_view()
+{
+    using namespace Cpp20RangesFromCharsView;
+
+    from_chars_view_01_introduction();
+    from_chars_view_02_file();
+    from_chars_view_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,289 @@
+// ===========================================================================
+// Concepts_06_StringConcat.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <concepts>
+#include <type_traits>
+#include <initializer_list>
+#include <charconv>
+#include <format>
+#include <algorithm>
+#include <functional>
+
+#include "Helpers.h"
+
+namespace StringConcat {
+
+    // concepts
+    template <typename T>
+    concept Character = std::same_as<std::remove_cvref_t<T>, char>;
+
+    template <typename T>
+    concept Integer = std::integral<std::remove_cvref_t<T>> &&
+        !Character<T> && !std::same_as<std::remove_cvref_t<T>, bool>;
+
+    template <typename T>
+    concept StringViewLike = std::convertible_to<const T&, std::string_view>;
+
+    // std::string, std::string_view, string literals, char and integers
+    template <typename T>
+    concept string_like = StringViewLike<T> || Character<T> || Integer<T>;
+
+    namespace details {
+
+        // exact number of characters of an argument
+        template <string_like T>
+        constexpr std::size_t length(const T& arg)
+        {
+            if constexpr (Character<T>) {
+                return 1;
+            }
+            else if constexpr (Integer<T>) {
+                using Unsigned = std::make_unsigned_t<T>;
+
+                std::size_t count{ 1 };
+                Unsigned value{ static_cast<Unsigned>(arg) };
+
+                if constexpr (std::is_signed_v<T>) {
+                    if (arg < 0) {
+                        ++count;
+                        value = static_cast<Unsigned>(Unsigned{} - value);
+                    }
+                }
+
+                while (value >= 10) {
+                    value /= 10;
+                    ++count;
+                }
+                return count;
+            }
+            else {
+                return std::string_view{ arg }.size();
+            }
+        }
+
+        // writes an argument, returns the position behind it
+        template <string_like T>
+        char* write(char* pos, const T& arg)
+        {
+            if constexpr (Character<T>) {
+                *pos = arg;
+                return pos + 1;
+            }
+            else if constexpr (Integer<T>) {
+                return std::to_chars(pos, pos + length(arg), arg).ptr;
+            }
+            else {
+                const std::string_view sv{ arg };
+                return std::copy(sv.begin(), sv.end(), pos);
+            }
+        }
+
+        // does an argument refer to the characters of 'dest' (or to 'dest' itself)?
+        template <string_like T>
+        bool aliases(const std::string& dest, const T& arg)
+        {
+            if constexpr (StringViewLike<T>) {
+                const std::string_view sv{ arg };
+                const std::less_equal<const char*> lessEqual{};   // total order, even for unrelated pointers
+                return lessEqual(dest.data(), sv.data()) && lessEqual(sv.data(), dest.data() + dest.size());
+            }
+            else {
+                return false;
+            }
+        }
+    }
+
+    // one pass over the arguments to calculate the length, one allocation,
+    // then every argument is written directly into the result -
+    // no std::initializer_list, no temporary std::string objects
+    template <string_like... ARGS>
+    std::string concat(const ARGS& ... args)
+    {
+        const std::size_t len{ (details::length(args) + ... + 0) };
+
+        std::string result;
+        result.resize_and_overwrite(len, [&](char* buffer, std::size_t) {
+            char* pos{ buffer };
+            ((pos = details::write(pos, args)), ...);
+            return static_cast<std::size_t>(pos - buffer);
+        });
+
+        return result;
+    }
+
+    // appends to an existing string, at most one reallocation.
+    // resize_and_overwrite may reallocate before the arguments are read:
+    // arguments referring to 'dest' itself are concatenated into a temporary first
+    template <string_like... ARGS>
+    void append(std::string& dest, const ARGS& ... args)
+    {
+        if ((details::aliases(dest, args) || ...)) {
+            dest += concat(args...);
+            return;
+        }
+
+        const std::size_t offset{ dest.size() };
+        const std::size_t len{ (details::length(args) + ... + 0) };
+
+        dest.resize_and_overwrite(offset + len, [&](char* buffer, std::size_t) {
+            char* pos{ buffer + offset };
+            ((pos = details::write(pos, args)), ...);
+            return static_cast<std::size_t>(pos - buffer);
+        });
+    }
+
+    void testConcat_01() {
+
+        std::string s1{ "111" };
+        std::string_view s2{ "222" };
+        const char* s3{ "333" };
+
+        std::string result{ concat(s1, '/', s2, '/', s3, '/', "444", '.') };
+        std::cout << result << std::endl;
+
+        // char arrays end at the terminating '\0', not at the end of the array
+        char buffer[64]{ "555" };
+        std::cout << concat('[', buffer, ']') << std::endl;
+    }
+
+    void testConcat_02() {
+
+        std::string result{ concat("x = ", 123, ", y = ", -45, ", max = ", 18446744073709551615ull) };
+        std::cout << result << std::endl;
+
+        append(result, " [", result.size(), ']');
+        std::cout << result << std::endl;
+
+        // arguments referring to the destination
+        std::string s{ "abc" };
+        append(s, s, '-', std::string_view{ s }.substr(1));
+        std::cout << s << std::endl;
+    }
+
+    // =======================================================================
+    // benchmark
+
+    namespace Reference {
+
+        // Concepts_05_Exercises.cpp
+        template <typename T>
+        concept IsString =
+            std::is_same<std::remove_cv_t<std::remove_reference_t<T>>, std::string>::value;
+
+        template<IsString... ARGS>
+        std::string concat(const ARGS& ... args)
+        {
+            size_t len{};
+            for (auto s : { args ... }) {
+                len += s.size();
+            }
+
+            std::string result;
+            result.reserve(len);
+
+            for (auto s : { args... }) {
+                result += s;
+            }
+
+            return result;
+        }
+
+        template<IsString... ARGS>
+        std::string concatImproved(const ARGS& ... args)
+        {
+            size_t len{};
+            for (auto s : { args ... }) {
+                len += s.size();
+            }
+
+            std::string result(len, '\0');
+
+            std::string::iterator it = std::begin(result);
+            for (auto s : { args... }) {
+                std::copy(std::begin(s), std::end(s), it);
+                it += s.size();
+            }
+
+            return result;
+        }
+    }
+
+    using Helpers::measure;
+
+    void testConcat_03_benchmark() {
+
+        constexpr std::size_t Iterations{ 2'000'000 };
+
+        const std::string directory{ "/usr/local/share/applications" };
+        const std::string name{ "configuration_of_the_application" };
+        const std::string extension{ "json" };
+        const std::string slash{ "/" };
+        const std::string dot{ "." };
+
+        measure("Exercises concat:          ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += Reference::concat(directory, slash, name, dot, extension).size();
+            }
+            return checksum;
+        });
+
+        measure("Exercises concatImproved:  ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += Reference::concatImproved(directory, slash, name, dot, extension).size();
+            }
+            return checksum;
+        });
+
+        measure("std::format:               ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += std::format("{}/{}.{}", directory, name, extension).size();
+            }
+            return checksum;
+        });
+
+        measure("concat:                    ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += concat(directory, '/', name, '.', extension).size();
+            }
+            return checksum;
+        });
+
+        // with integers
+        measure("std::format (integers):    ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += std::format("{}/{}_{}.{}", directory, name, i, extension).size();
+            }
+            return checksum;
+        });
+
+        measure("concat (integers):         ", [&] {
+            std::size_t checksum{};
+            for (std::size_t i{}; i != Iterations; ++i) {
+                checksum += concat(directory, '/', name, '_', i, '.', extension).size();
+            }
+            return checksum;
+        });
+    }
+}
+
+void example_string_concat()
+{
+    using namespace StringConcat;
+
+    testConcat_01();
+    testConcat_02();
+    testConcat_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
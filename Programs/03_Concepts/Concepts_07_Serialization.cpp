@@ -0,0 +1,510 @@
+// ===========================================================================
+// Concepts_07_Serialization.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <sstream>
+#include <concepts>
+#include <type_traits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <ranges>
+#include <iterator>
+#include <charconv>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include "Helpers.h"
+
+namespace Serialization {
+
+    // -----------------------------------------------------------------------
+    // concepts: every kind of type has its own (cheapest) path
+
+    template <typename T>
+    concept Boolean = std::same_as<T, bool>;
+
+    template <typename T>
+    concept Character = std::same_as<T, char>;
+
+    // signed char, unsigned char, std::int8_t and std::uint8_t are numbers
+    // (like std::to_string, unlike operator<<), floating-point values are
+    // written in the shortest form that reads back exactly (21.5, 0.1, 1e+20 -
+    // neither std::to_string's 21.500000 nor the 6 digits of a stream)
+    template <typename T>
+    concept Arithmetic = (std::integral<T> || std::floating_point<T>) && !Boolean<T> && !Character<T>;
+
+    template <typename T>
+    concept StringLike = std::convertible_to<const T&, std::string_view>;
+
+    template <typename T>
+    concept Range = std::ranges::input_range<const T> && !StringLike<T>;
+
+    template <typename T>
+    concept TupleLike = !Range<T> && requires {
+        std::tuple_size<T>::value;
+    };
+
+    template <typename T>
+    concept Streamable = requires(const T & x, std::ostream & os) {
+        { os << x } -> std::same_as<std::ostream&>;
+    };
+
+    // -----------------------------------------------------------------------
+    // number of members of an aggregate: T{ any, any, ... } compiles
+    // as long as the number of initializers doesn't exceed the number of members
+
+    namespace details {
+
+        struct any_field
+        {
+            template <typename T>
+            operator T() const;     // declaration only, used in unevaluated context
+        };
+
+        template <typename T, typename... ARGS>
+        consteval std::size_t fieldCount()
+        {
+            if constexpr (sizeof...(ARGS) <= 8 && requires { T{ ARGS{}..., any_field{} }; }) {
+                return fieldCount<T, ARGS..., any_field>();
+            }
+            else {
+                return sizeof...(ARGS);
+            }
+        }
+
+        template <typename T, typename TFunc>
+        constexpr void forEachField(const T& obj, TFunc&& func)
+        {
+            constexpr std::size_t count{ fieldCount<T>() };
+
+            if constexpr (count == 1) {
+                const auto& [m1] = obj;
+                func(m1);
+            }
+            else if constexpr (count == 2) {
+                const auto& [m1, m2] = obj;
+                func(m1); func(m2);
+            }
+            else if constexpr (count == 3) {
+                const auto& [m1, m2, m3] = obj;
+                func(m1); func(m2); func(m3);
+            }
+            else if constexpr (count == 4) {
+                const auto& [m1, m2, m3, m4] = obj;
+                func(m1); func(m2); func(m3); func(m4);
+            }
+            else if constexpr (count == 5) {
+                const auto& [m1, m2, m3, m4, m5] = obj;
+                func(m1); func(m2); func(m3); func(m4); func(m5);
+            }
+            else if constexpr (count == 6) {
+                const auto& [m1, m2, m3, m4, m5, m6] = obj;
+                func(m1); func(m2); func(m3); func(m4); func(m5); func(m6);
+            }
+            else if constexpr (count == 7) {
+                const auto& [m1, m2, m3, m4, m5, m6, m7] = obj;
+                func(m1); func(m2); func(m3); func(m4); func(m5); func(m6); func(m7);
+            }
+            else if constexpr (count == 8) {
+                const auto& [m1, m2, m3, m4, m5, m6, m7, m8] = obj;
+                func(m1); func(m2); func(m3); func(m4); func(m5); func(m6); func(m7); func(m8);
+            }
+        }
+    }
+
+    // aggregates with 1 up to 8 members (no array members)
+    template <typename T>
+    concept Aggregate = std::is_aggregate_v<T> && !std::is_array_v<T> && !Range<T> && !TupleLike<T> &&
+        details::fieldCount<T>() >= 1 && details::fieldCount<T>() <= 8;
+
+    // -----------------------------------------------------------------------
+    // text mode
+
+    template <typename T>
+    concept TextSerializable =
+        Boolean<T> || Character<T> || Arithmetic<T> || StringLike<T> ||
+        Range<T> || TupleLike<T> || Aggregate<T> || Streamable<T>;
+
+    template <std::output_iterator<char> TOut, TextSerializable T>
+    TOut serialize_to(TOut out, const T& value)
+    {
+        if constexpr (Boolean<T>) {
+            const std::string_view text{ value ? "true" : "false" };
+            return std::ranges::copy(text, out).out;
+        }
+        else if constexpr (Character<T>) {
+            *out++ = value;
+            return out;
+        }
+        else if constexpr (Arithmetic<T>) {
+            std::array<char, 64> buffer{};
+            const auto [ptr, ec] { std::to_chars(buffer.data(), buffer.data() + buffer.size(), value) };
+            if (ec != std::errc{}) {
+                throw std::system_error{ std::make_error_code(ec), "serialize_to" };
+            }
+            return std::copy(buffer.data(), ptr, out);
+        }
+        else if constexpr (StringLike<T>) {
+            return std::ranges::copy(std::string_view{ value }, out).out;
+        }
+        else if constexpr (Range<T>) {
+            *out++ = '[';
+            bool first{ true };
+            for (const auto& elem : value) {
+                if (!first) {
+                    *out++ = ',';
+                }
+                out = serialize_to(out, elem);
+                first = false;
+            }
+            *out++ = ']';
+            return out;
+        }
+        else if constexpr (TupleLike<T> || Aggregate<T>) {
+            *out++ = '(';
+            bool first{ true };
+            auto field = [&](const auto& member) {
+                if (!first) {
+                    *out++ = ',';
+                }
+                out = serialize_to(out, member);
+                first = false;
+            };
+
+            if constexpr (TupleLike<T>) {
+                std::apply([&](const auto&... members) { (field(members), ...); }, value);
+            }
+            else {
+                details::forEachField(value, field);
+            }
+
+            *out++ = ')';
+            return out;
+        }
+        else {
+            // last resort
+            std::ostringstream os;
+            os << value;
+            return std::ranges::copy(os.view(), out).out;
+        }
+    }
+
+    template <TextSerializable T>
+    void serialize_append(std::string& dest, const T& value)
+    {
+        serialize_to(std::back_inserter(dest), value);
+    }
+
+    template <TextSerializable T>
+    std::string serialize(const T& value)
+    {
+        std::string result;
+        serialize_append(result, value);
+        return result;
+    }
+
+    // caller-supplied buffer, comparable to std::format_to_n:
+    // at most 'n' characters are written, 'size' is the total length
+    template <typename TOut>
+    struct serialize_to_n_result
+    {
+        TOut out;
+        std::ptrdiff_t size;
+    };
+
+    namespace details {
+
+        template <typename TOut>
+        class truncating_iterator
+        {
+        private:
+            TOut           m_out{};
+            std::ptrdiff_t m_limit{};
+            std::ptrdiff_t m_count{};
+
+        public:
+            using difference_type = std::ptrdiff_t;
+
+            truncating_iterator() = default;
+            truncating_iterator(TOut out, std::ptrdiff_t limit) : m_out{ out }, m_limit{ limit }, m_count{} {}
+
+            truncating_iterator& operator* () { return *this; }
+            truncating_iterator& operator++ () { return *this; }
+            truncating_iterator& operator++ (int) { return *this; }
+
+            truncating_iterator& operator= (char ch)
+            {
+                if (m_count < m_limit) {
+                    *m_out++ = ch;
+                }
+                ++m_count;
+                return *this;
+            }
+
+            TOut out() const { return m_out; }
+            std::ptrdiff_t count() const { return m_count; }
+        };
+    }
+
+    template <std::output_iterator<char> TOut, TextSerializable T>
+    serialize_to_n_result<TOut> serialize_to_n(TOut out, std::ptrdiff_t n, const T& value)
+    {
+        auto result{ serialize_to(details::truncating_iterator<TOut>{ out, n }, value) };
+        return { result.out(), result.count() };
+    }
+
+    // -----------------------------------------------------------------------
+    // binary mode: little endian, strings and ranges with a 64-bit length prefix
+
+    // long double is excluded: its object representation differs between
+    // platforms (8 bytes with MSVC, 10 value bytes plus padding with GCC on x86)
+    template <typename T>
+    concept BinaryArithmetic = Arithmetic<T> && !std::same_as<T, long double>;
+
+    template <typename T>
+    concept BinarySerializable =
+        Boolean<T> || Character<T> || BinaryArithmetic<T> || StringLike<T> ||
+        Range<T> || TupleLike<T> || Aggregate<T>;
+
+    template <std::output_iterator<std::byte> TOut, BinarySerializable T>
+    TOut serialize_binary_to(TOut out, const T& value)
+    {
+        if constexpr (Boolean<T> || Character<T> || BinaryArithmetic<T>) {
+            auto bytes{ std::bit_cast<std::array<std::byte, sizeof(T)>>(value) };
+            if constexpr (std::endian::native == std::endian::big) {
+                std::ranges::reverse(bytes);
+            }
+            return std::ranges::copy(bytes, out).out;
+        }
+        else if constexpr (StringLike<T>) {
+            const std::string_view sv{ value };
+            out = serialize_binary_to(out, static_cast<std::uint64_t>(sv.size()));
+            return std::ranges::transform(sv, out, [](char ch) { return static_cast<std::byte>(ch); }).out;
+        }
+        else if constexpr (Range<T>) {
+            if constexpr (std::ranges::sized_range<const T>) {
+                out = serialize_binary_to(out, static_cast<std::uint64_t>(std::ranges::size(value)));
+            }
+            else {
+                out = serialize_binary_to(out, static_cast<std::uint64_t>(std::ranges::distance(value)));
+            }
+            for (const auto& elem : value) {
+                out = serialize_binary_to(out, elem);
+            }
+            return out;
+        }
+        else if constexpr (TupleLike<T>) {
+            std::apply([&](const auto&... members) { ((out = serialize_binary_to(out, members)), ...); }, value);
+            return out;
+        }
+        else {
+            details::forEachField(value, [&](const auto& member) { out = serialize_binary_to(out, member); });
+            return out;
+        }
+    }
+
+    template <BinarySerializable T>
+    std::vector<std::byte> serialize_binary(const T& value)
+    {
+        std::vector<std::byte> result;
+        serialize_binary_to(std::back_inserter(result), value);
+        return result;
+    }
+
+    // -----------------------------------------------------------------------
+    // examples
+
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    std::ostream& operator<<(std::ostream& os, point const& p)
+    {
+        os << '(' << p.x << ',' << p.y << ')';
+        return os;
+    }
+
+    struct measurement
+    {
+        std::string sensor;
+        point position;
+        double value;
+        bool valid;
+    };
+
+    // only streamable, not an aggregate
+    class temperature
+    {
+    private:
+        double m_celsius;
+
+    public:
+        explicit temperature(double celsius) : m_celsius{ celsius } {}
+
+        friend std::ostream& operator<<(std::ostream& os, const temperature& t)
+        {
+            os << t.m_celsius << " C";
+            return os;
+        }
+    };
+
+    static_assert(Arithmetic<int> && Arithmetic<double>);
+    static_assert(Aggregate<point> && Aggregate<measurement>);
+    static_assert(TupleLike<std::pair<int, int>>);
+    static_assert(Range<std::vector<point>> && !Range<std::string>);
+    static_assert(TextSerializable<temperature> && !BinarySerializable<temperature>);
+    static_assert(TextSerializable<long double> && !BinarySerializable<long double>);
+
+    void serialization_01()
+    {
+        std::cout << serialize(42) << '\n';
+        std::cout << serialize(point{ 1, 2 }) << '\n';
+        std::cout << serialize(std::pair<int, int>{ 1, 2 }) << '\n';     // not possible with as_string
+        std::cout << serialize(measurement{ "T1", { 3, 4 }, 21.5, true }) << '\n';
+        std::cout << serialize(std::vector<point>{ { 1, 2 }, { 3, 4 }, { 5, 6 } }) << '\n';
+        std::cout << serialize(temperature{ 36.6 }) << '\n';
+
+        // 65 0.1 0.3333333333333333 - as_string: 65 0.100000 0.333333
+        std::uint8_t byte{ 65 };
+        std::cout << serialize(byte) << ' ' << serialize(0.1) << ' ' << serialize(1.0 / 3.0) << '\n';
+    }
+
+    void serialization_02()
+    {
+        // caller-supplied buffer
+        std::array<char, 16> buffer{};
+        auto [out, size] { serialize_to_n(buffer.data(), std::ssize(buffer), measurement{ "T1", { 3, 4 }, 21.5, true }) };
+
+        std::cout << std::string_view{ buffer.data(), out } << " (" << size << " characters needed)" << '\n';
+
+        // reusing a string
+        std::string line;
+        for (int i{ 1 }; i <= 3; ++i) {
+            line.clear();
+            serialize_append(line, point{ i, i * i });
+            std::cout << line << '\n';
+        }
+
+        // binary
+        std::vector<std::byte> bytes{ serialize_binary(measurement{ "T1", { 3, 4 }, 21.5, true }) };
+
+        std::cout << bytes.size() << " bytes:";
+        for (std::byte b : bytes) {
+            std::cout << ' ' << std::to_integer<int>(b);
+        }
+        std::cout << '\n';
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark
+
+    namespace Reference {
+
+        // Concepts_03_ReqClauseVsReqExp.cpp
+        template <typename T>
+        constexpr bool always_false = std::false_type::value;
+
+        template <typename T>
+        std::string as_string(T a)
+        {
+            constexpr bool has_to_string = requires(T x)
+            {
+                { std::to_string(x) } -> std::convertible_to<std::string>;
+            };
+
+            constexpr bool has_stream = requires(T x, std::ostream & os)
+            {
+                {os << x} -> std::same_as<std::ostream&>;
+            };
+
+            if constexpr (has_to_string)
+            {
+                return std::to_string(a);
+            }
+            else if constexpr (has_stream)
+            {
+                std::stringstream s;
+                s << a;
+                return s.str();
+            }
+            else
+                static_assert(always_false<T>, "The type cannot be serialized");
+        }
+    }
+
+    using Helpers::measure;
+
+    void serialization_03_benchmark()
+    {
+        constexpr int Count{ 2'000'000 };
+
+        measure("as_string(point):              ", [] {
+            std::size_t checksum{};
+            for (int i{}; i != Count; ++i) {
+                checksum += Reference::as_string(point{ i, -i }).size();
+            }
+            return checksum;
+        });
+
+        measure("serialize(point):              ", [] {
+            std::size_t checksum{};
+            for (int i{}; i != Count; ++i) {
+                checksum += serialize(point{ i, -i }).size();
+            }
+            return checksum;
+        });
+
+        measure("serialize_append(point):       ", [] {
+            std::size_t checksum{};
+            std::string line;
+            for (int i{}; i != Count; ++i) {
+                line.clear();
+                serialize_append(line, point{ i, -i });
+                checksum += line.size();
+            }
+            return checksum;
+        });
+
+        measure("serialize_to_n(point):         ", [] {
+            std::size_t checksum{};
+            std::array<char, 64> buffer{};
+            for (int i{}; i != Count; ++i) {
+                checksum += serialize_to_n(buffer.data(), std::ssize(buffer), point{ i, -i }).size;
+            }
+            return checksum;
+        });
+
+        measure("serialize_binary_to(point):    ", [] {
+            std::size_t checksum{};
+            std::array<std::byte, 64> buffer{};
+            for (int i{}; i != Count; ++i) {
+                const std::byte* end{ serialize_binary_to(buffer.data(), point{ i, -i }) };
+                checksum += std::to_integer<std::size_t>(buffer[i % 8]) + static_cast<std::size_t>(end - buffer.data());
+            }
+            return checksum;
+        });
+    }
+}
+
+void example_serialization()
+{
+    using namespace Serialization;
+
+    serialization_01();
+    serialization_02();
+    serialization_03_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
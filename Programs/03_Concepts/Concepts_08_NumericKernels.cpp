@@ -0,0 +1,675 @@
+// ===========================================================================
+// Concepts_08_NumericKernels.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NUMERIC_KERNELS_X64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// GCC and Clang: AVX2 intrinsics are only available in functions
+// with a corresponding target attribute
+#if defined(NUMERIC_KERNELS_X64) && (defined(__GNUC__) || defined(__clang__))
+#define NUMERIC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define NUMERIC_TARGET_AVX2
+#endif
+
+#include <iostream>
+#include <iomanip>
+#include <concepts>
+#include <type_traits>
+#include <ranges>
+#include <iterator>
+#include <vector>
+#include <list>
+#include <array>
+#include <span>
+#include <numeric>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <random>
+#include <string>
+
+#include "Helpers.h"
+
+namespace NumericKernels {
+
+    // -----------------------------------------------------------------------
+    // concepts (Concepts_04_MoreExamples.cpp)
+
+    template<typename T>
+    concept Number = std::integral<T> || std::floating_point<T>;
+
+    template<typename T>
+    concept Integer = std::integral<T>;
+
+    template<typename T>
+    concept Float = std::floating_point<T>;
+
+    template<typename R>
+    concept NumberRange = std::ranges::input_range<R> && Number<std::ranges::range_value_t<R>>;
+
+    template<typename R>
+    concept ContiguousNumberRange = NumberRange<R> &&
+        std::ranges::contiguous_range<R> && std::ranges::sized_range<R>;
+
+    // -----------------------------------------------------------------------
+    // instruction set: detected once, can be lowered for comparisons
+
+    enum class isa { scalar, avx2 };
+
+    namespace details {
+
+        static isa detectIsa()
+        {
+#if defined(NUMERIC_KERNELS_X64)
+            unsigned int regs[4]{};
+#if defined(_MSC_VER)
+            int info[4]{};
+            __cpuidex(info, 0, 0);
+            const unsigned int maxLeaf{ static_cast<unsigned int>(info[0]) };
+            __cpuidex(info, 1, 0);
+            regs[2] = static_cast<unsigned int>(info[2]);
+#else
+            const unsigned int maxLeaf{ __get_cpuid_max(0, nullptr) };
+            __cpuid_count(1, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+            const bool osxsave{ (regs[2] & (1u << 27)) != 0 };
+            const bool avx{ (regs[2] & (1u << 28)) != 0 };
+
+            if (!osxsave || !avx || maxLeaf < 7) {
+                return isa::scalar;
+            }
+
+#if defined(_MSC_VER)
+            const std::uint64_t xcr0{ _xgetbv(0) };
+            __cpuidex(info, 7, 0);
+            regs[1] = static_cast<unsigned int>(info[1]);
+#else
+            unsigned int eax{}, edx{};
+            __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            const std::uint64_t xcr0{ (static_cast<std::uint64_t>(edx) << 32) | eax };
+            __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+            const bool ymmState{ (xcr0 & 0x06) == 0x06 };
+            const bool avx2{ (regs[1] & (1u << 5)) != 0 };
+
+            return (avx2 && ymmState) ? isa::avx2 : isa::scalar;
+#else
+            return isa::scalar;
+#endif
+        }
+
+        inline isa& activeIsa()
+        {
+            static isa level{ detectIsa() };
+            return level;
+        }
+    }
+
+    inline isa supportedIsa()
+    {
+        static const isa level{ details::detectIsa() };
+        return level;
+    }
+
+    inline isa currentIsa() { return details::activeIsa(); }
+
+    inline void setIsa(isa level)
+    {
+        details::activeIsa() = std::min(level, supportedIsa());
+    }
+
+    // -----------------------------------------------------------------------
+    // wide accumulation of integers
+
+    template <Integer T>
+    using wide_t = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+    namespace details {
+
+        // true on overflow
+        template <Integer T>
+        bool addOverflow(T a, T b, T& result)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_add_overflow(a, b, &result);
+#else
+            if constexpr (std::is_signed_v<T>) {
+                if ((b > 0 && a > std::numeric_limits<T>::max() - b) ||
+                    (b < 0 && a < std::numeric_limits<T>::min() - b)) {
+                    return true;
+                }
+            }
+            else {
+                if (a > std::numeric_limits<T>::max() - b) {
+                    return true;
+                }
+            }
+            result = a + b;
+            return false;
+#endif
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // kernels: one namespace per instruction set
+
+    namespace kernels::scalar {
+
+        // eight independent partial sums, the compiler can vectorize this loop
+        template <Float T>
+        T blockSum(const T* data, std::size_t size)
+        {
+            std::array<T, 8> partial{};
+
+            std::size_t i{};
+            for (; i + 8 <= size; i += 8) {
+                for (std::size_t k{}; k != 8; ++k) {
+                    partial[k] += data[i + k];
+                }
+            }
+            for (; i != size; ++i) {
+                partial[0] += data[i];
+            }
+
+            return ((partial[0] + partial[1]) + (partial[2] + partial[3])) +
+                ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+        }
+
+        // elements narrower than 64 bit: at most 2^31 elements per call,
+        // the sum cannot overflow the 64-bit accumulator
+        template <Integer T>
+            requires (sizeof(T) < sizeof(std::int64_t))
+        wide_t<T> chunkSum(const T* data, std::size_t size)
+        {
+            wide_t<T> sum{};
+            for (std::size_t i{}; i != size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        // 64-bit elements: true on overflow of a partial sum
+        template <Integer T>
+            requires (sizeof(T) == sizeof(std::int64_t))
+        bool checkedSum(const T* data, std::size_t size, wide_t<T>& result)
+        {
+            for (std::size_t i{}; i != size; ++i) {
+                if (details::addOverflow(result, static_cast<wide_t<T>>(data[i]), result)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    namespace kernels::avx2 {
+
+#if defined(NUMERIC_KERNELS_X64)
+        NUMERIC_TARGET_AVX2
+        inline double blockSum(const double* data, std::size_t size)
+        {
+            __m256d acc0{ _mm256_setzero_pd() };
+            __m256d acc1{ _mm256_setzero_pd() };
+            __m256d acc2{ _mm256_setzero_pd() };
+            __m256d acc3{ _mm256_setzero_pd() };
+
+            std::size_t i{};
+            for (; i + 16 <= size; i += 16) {
+                acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+                acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+                acc2 = _mm256_add_pd(acc2, _mm256_loadu_pd(data + i + 8));
+                acc3 = _mm256_add_pd(acc3, _mm256_loadu_pd(data + i + 12));
+            }
+
+            const __m256d acc{ _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)) };
+            alignas(32) double lanes[4]{};
+            _mm256_store_pd(lanes, acc);
+
+            double sum{ (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) };
+            for (; i != size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        NUMERIC_TARGET_AVX2
+        inline float blockSum(const float* data, std::size_t size)
+        {
+            __m256 acc0{ _mm256_setzero_ps() };
+            __m256 acc1{ _mm256_setzero_ps() };
+            __m256 acc2{ _mm256_setzero_ps() };
+            __m256 acc3{ _mm256_setzero_ps() };
+
+            std::size_t i{};
+            for (; i + 32 <= size; i += 32) {
+                acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+                acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(data + i + 8));
+                acc2 = _mm256_add_ps(acc2, _mm256_loadu_ps(data + i + 16));
+                acc3 = _mm256_add_ps(acc3, _mm256_loadu_ps(data + i + 24));
+            }
+
+            const __m256 acc{ _mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3)) };
+            alignas(32) float lanes[8]{};
+            _mm256_store_ps(lanes, acc);
+
+            float sum{ ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7])) };
+            for (; i != size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        // four 16-bit or 32-bit integers, widened to 64 bit
+        template <Integer T>
+        NUMERIC_TARGET_AVX2
+        inline __m256i loadWidened(const T* data)
+        {
+            if constexpr (sizeof(T) == 2) {
+                const __m128i x{ _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)) };
+                return std::is_signed_v<T> ? _mm256_cvtepi16_epi64(x) : _mm256_cvtepu16_epi64(x);
+            }
+            else {
+                const __m128i x{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)) };
+                return std::is_signed_v<T> ? _mm256_cvtepi32_epi64(x) : _mm256_cvtepu32_epi64(x);
+            }
+        }
+
+        // 8-bit integers: sum of absolute differences to zero adds 8 bytes
+        // into one 64-bit lane, signed bytes are biased by 128 (xor 0x80).
+        // 16-bit and 32-bit integers are widened to 64 bit
+        template <Integer T>
+            requires (sizeof(T) < sizeof(std::int64_t))
+        NUMERIC_TARGET_AVX2
+        wide_t<T> chunkSum(const T* data, std::size_t size)
+        {
+            __m256i acc0{ _mm256_setzero_si256() };
+            __m256i acc1{ _mm256_setzero_si256() };
+
+            std::size_t i{};
+            if constexpr (sizeof(T) == 1) {
+                const __m256i zero{ _mm256_setzero_si256() };
+                const __m256i bias{ _mm256_set1_epi8(std::is_signed_v<T> ? static_cast<char>(0x80) : 0) };
+
+                for (; i + 64 <= size; i += 64) {
+                    const __m256i x0{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)) };
+                    const __m256i x1{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32)) };
+                    acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(_mm256_xor_si256(x0, bias), zero));
+                    acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(_mm256_xor_si256(x1, bias), zero));
+                }
+            }
+            else {
+                for (; i + 8 <= size; i += 8) {
+                    acc0 = _mm256_add_epi64(acc0, loadWidened(data + i));
+                    acc1 = _mm256_add_epi64(acc1, loadWidened(data + i + 4));
+                }
+            }
+
+            alignas(32) std::int64_t lanes[4]{};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+
+            wide_t<T> sum{ static_cast<wide_t<T>>(lanes[0] + lanes[1] + lanes[2] + lanes[3]) };
+            if constexpr (sizeof(T) == 1 && std::is_signed_v<T>) {
+                sum -= 128 * static_cast<wide_t<T>>(i);
+            }
+            for (; i != size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        // 64-bit integers: lanes with overflow detection. true if a lane
+        // overflowed - the lanes add the elements in another order than
+        // the scalar kernel, which decides in this case
+        template <Integer T>
+            requires (sizeof(T) == sizeof(std::int64_t))
+        NUMERIC_TARGET_AVX2
+        bool checkedSum(const T* data, std::size_t size, wide_t<T>& result)
+        {
+            const __m256i sign{ _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min()) };
+
+            __m256i acc0{ _mm256_setzero_si256() };
+            __m256i acc1{ _mm256_setzero_si256() };
+            __m256i overflow{ _mm256_setzero_si256() };
+
+            std::size_t i{};
+            for (; i + 8 <= size; i += 8) {
+                const __m256i x0{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)) };
+                const __m256i x1{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 4)) };
+                const __m256i sum0{ _mm256_add_epi64(acc0, x0) };
+                const __m256i sum1{ _mm256_add_epi64(acc1, x1) };
+
+                if constexpr (std::is_signed_v<T>) {
+                    // sign bit: both operands differ in sign from the sum
+                    overflow = _mm256_or_si256(overflow, _mm256_and_si256(_mm256_xor_si256(acc0, sum0), _mm256_xor_si256(x0, sum0)));
+                    overflow = _mm256_or_si256(overflow, _mm256_and_si256(_mm256_xor_si256(acc1, sum1), _mm256_xor_si256(x1, sum1)));
+                }
+                else {
+                    // the sum is less than an operand (unsigned: compare with flipped sign bits)
+                    overflow = _mm256_or_si256(overflow, _mm256_cmpgt_epi64(_mm256_xor_si256(x0, sign), _mm256_xor_si256(sum0, sign)));
+                    overflow = _mm256_or_si256(overflow, _mm256_cmpgt_epi64(_mm256_xor_si256(x1, sign), _mm256_xor_si256(sum1, sign)));
+                }
+
+                acc0 = sum0;
+                acc1 = sum1;
+            }
+
+            if (_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0) {
+                return true;
+            }
+
+            alignas(32) wide_t<T> lanes[8]{};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc0);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes + 4), acc1);
+
+            wide_t<T> sum{};
+            for (const wide_t<T> lane : lanes) {
+                if (details::addOverflow(sum, lane, sum)) {
+                    return true;
+                }
+            }
+            for (; i != size; ++i) {
+                if (details::addOverflow(sum, static_cast<wide_t<T>>(data[i]), sum)) {
+                    return true;
+                }
+            }
+
+            result = sum;
+            return false;
+        }
+#endif
+    }
+
+    namespace details {
+
+        template <Float T>
+        T blockSum(const T* data, std::size_t size)
+        {
+#if defined(NUMERIC_KERNELS_X64)
+            if constexpr (std::same_as<T, double> || std::same_as<T, float>) {
+                if (currentIsa() == isa::avx2) {
+                    return kernels::avx2::blockSum(data, size);
+                }
+            }
+#endif
+            return kernels::scalar::blockSum(data, size);
+        }
+
+        template <Integer T>
+            requires (sizeof(T) < sizeof(std::int64_t))
+        wide_t<T> chunkSum(const T* data, std::size_t size)
+        {
+#if defined(NUMERIC_KERNELS_X64)
+            if (currentIsa() == isa::avx2) {
+                return kernels::avx2::chunkSum(data, size);
+            }
+#endif
+            return kernels::scalar::chunkSum(data, size);
+        }
+
+        // true on overflow
+        template <Integer T>
+            requires (sizeof(T) == sizeof(std::int64_t))
+        bool checkedSum(const T* data, std::size_t size, wide_t<T>& result)
+        {
+#if defined(NUMERIC_KERNELS_X64)
+            if (currentIsa() == isa::avx2) {
+                wide_t<T> sum{};
+                if (!kernels::avx2::checkedSum(data, size, sum)) {
+                    result = sum;
+                    return false;
+                }
+            }
+#endif
+            return kernels::scalar::checkedSum(data, size, result);
+        }
+
+        // recursive halving down to blocks: the rounding error grows
+        // with O(log n) instead of O(n)
+        template <Float T>
+        T pairwiseSum(const T* data, std::size_t size)
+        {
+            constexpr std::size_t BlockSize{ 1024 };
+
+            if (size <= BlockSize) {
+                return blockSum(data, size);
+            }
+
+            const std::size_t half{ (size / 2 + BlockSize - 1) / BlockSize * BlockSize };
+            return pairwiseSum(data, half) + pairwiseSum(data + half, size - half);
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // summation algorithms
+
+    // compensated summation (Kahan): any input range of floating point numbers,
+    // the rounding error of every addition is added to the next value
+    template <std::ranges::input_range R>
+        requires Float<std::ranges::range_value_t<R>>
+    auto kahan_sum(R&& range)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        T sum{};
+        T compensation{};
+
+        for (const T value : range) {
+            const T y{ value - compensation };
+            const T t{ sum + y };
+            compensation = (t - sum) - y;
+            sum = t;
+        }
+
+        return sum;
+    }
+
+    // pairwise summation: contiguous ranges of floating point numbers
+    template <ContiguousNumberRange R>
+        requires Float<std::ranges::range_value_t<R>>
+    auto pairwise_sum(R&& range)
+    {
+        return details::pairwiseSum(std::ranges::data(range), std::ranges::size(range));
+    }
+
+    // 64-bit accumulation of integers, throws std::overflow_error.
+    // 64-bit elements: a returned sum is always exact - whether the overflow
+    // of an intermediate sum that is compensated later on throws depends on
+    // the order of the additions (scalar or AVX2 lanes)
+    template <NumberRange R>
+        requires Integer<std::ranges::range_value_t<R>>
+    auto checked_sum(R&& range)
+    {
+        using T = std::ranges::range_value_t<R>;
+        using W = wide_t<T>;
+
+        W sum{};
+
+        if constexpr (sizeof(T) <= sizeof(W) && std::ranges::contiguous_range<R> && std::ranges::sized_range<R>) {
+
+            const T* data{ std::ranges::data(range) };
+            const std::size_t size{ std::ranges::size(range) };
+
+            if constexpr (sizeof(T) < sizeof(W)) {
+                constexpr std::size_t ChunkSize{ std::size_t{ 1 } << 31 };
+
+                for (std::size_t first{}; first < size; first += ChunkSize) {
+                    const W chunk{ details::chunkSum(data + first, std::min(ChunkSize, size - first)) };
+                    if (details::addOverflow(sum, chunk, sum)) {
+                        throw std::overflow_error{ "checked_sum: overflow" };
+                    }
+                }
+            }
+            else if (details::checkedSum(data, size, sum)) {
+                throw std::overflow_error{ "checked_sum: overflow" };
+            }
+        }
+        else {
+            for (const T value : range) {
+                if (details::addOverflow(sum, static_cast<W>(value), sum)) {
+                    throw std::overflow_error{ "checked_sum: overflow" };
+                }
+            }
+        }
+
+        return sum;
+    }
+
+    // one interface, implementation selected by the concepts
+    template <NumberRange R>
+    auto sum(R&& range)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        if constexpr (Integer<T>) {
+            return checked_sum(std::forward<R>(range));
+        }
+        else if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R>) {
+            return pairwise_sum(std::forward<R>(range));
+        }
+        else {
+            return kahan_sum(std::forward<R>(range));
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // examples
+
+    void numeric_kernels_01()
+    {
+        std::vector<int> numbers{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        std::cout << "sum (vector<int>):    " << sum(numbers) << std::endl;
+
+        std::list<double> values{ 0.1, 0.2, 0.3 };
+        std::cout << "sum (list<double>):   " << sum(values) << std::endl;
+
+        std::vector<std::int32_t> large(10, std::numeric_limits<std::int32_t>::max());
+        std::cout << "sum (10 * INT_MAX):   " << sum(large) << std::endl;
+
+        std::vector<std::int64_t> huge{ std::numeric_limits<std::int64_t>::max(), 1 };
+        try {
+            std::cout << sum(huge) << std::endl;
+        }
+        catch (const std::overflow_error& e) {
+            std::cout << "Exception: " << e.what() << std::endl;
+        }
+
+        std::cout << "Instruction set:      " << (currentIsa() == isa::avx2 ? "AVX2" : "scalar") << std::endl;
+    }
+
+    // -----------------------------------------------------------------------
+    // accuracy and throughput
+
+    void numeric_kernels_02_accuracy()
+    {
+        constexpr std::size_t Count{ 10'000'000 };
+
+        // 0.1f can't be represented exactly: the exact sum of the float values
+        // is computed with double precision and compensation
+        std::vector<float> values(Count, 0.1f);
+
+        std::vector<double> widened(values.begin(), values.end());
+        const double exact{ kahan_sum(widened) };
+
+        auto report = [&](const std::string& label, double result) {
+            std::cout << label << std::setprecision(10) << result
+                << "  (relative error " << std::setprecision(3)
+                << std::abs(result - exact) / exact << ")" << std::endl;
+        };
+
+        std::cout << "Sum of " << Count << " * 0.1f:" << std::endl;
+        report("  std::accumulate: ", std::accumulate(values.begin(), values.end(), 0.0f));
+        report("  pairwise_sum:    ", pairwise_sum(values));
+        report("  kahan_sum:       ", kahan_sum(values));
+        std::cout << std::setprecision(6);
+    }
+
+    template <typename TFunc>
+    void measure(const std::string& label, TFunc func)
+    {
+        constexpr std::size_t Repetitions{ 10 };
+
+        // every repetition starts at another offset: the calls can't be merged
+        Helpers::measure(label, [&]() {
+            auto result{ func(0) };
+            for (std::size_t i{ 1 }; i != Repetitions; ++i) {
+                result += func(i);
+            }
+            return result;
+        });
+    }
+
+    void numeric_kernels_03_throughput()
+    {
+        constexpr std::size_t Count{ 10'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_real_distribution<double> realDistribution{ -1.0, 1.0 };
+        std::uniform_int_distribution<std::int32_t> intDistribution{ -1'000'000, 1'000'000 };
+
+        std::vector<double> reals(Count);
+        for (auto& value : reals) {
+            value = realDistribution(generator);
+        }
+
+        std::vector<std::int32_t> ints(Count);
+        for (auto& value : ints) {
+            value = intDistribution(generator);
+        }
+
+        std::vector<std::int8_t> bytes(ints.begin(), ints.end());        // truncated
+        std::vector<std::int64_t> longs(ints.begin(), ints.end());
+
+        auto from = [](const auto& vec, std::size_t offset) { return std::span{ vec }.subspan(offset); };
+
+        std::cout << "10 * " << Count << " elements:" << std::endl;
+
+        measure("  std::accumulate (double):     ", [&](std::size_t i) { return std::accumulate(reals.begin() + i, reals.end(), 0.0); });
+        measure("  kahan_sum (double):           ", [&](std::size_t i) { return kahan_sum(from(reals, i)); });
+
+        setIsa(isa::scalar);
+        measure("  pairwise_sum (double, scalar):", [&](std::size_t i) { return pairwise_sum(from(reals, i)); });
+        setIsa(isa::avx2);
+        measure("  pairwise_sum (double, AVX2):  ", [&](std::size_t i) { return pairwise_sum(from(reals, i)); });
+
+        measure("  std::accumulate (int32):      ", [&](std::size_t i) { return std::accumulate(ints.begin() + i, ints.end(), std::int64_t{}); });
+
+        setIsa(isa::scalar);
+        measure("  checked_sum (int32, scalar):  ", [&](std::size_t i) { return checked_sum(from(ints, i)); });
+        setIsa(isa::avx2);
+        measure("  checked_sum (int32, AVX2):    ", [&](std::size_t i) { return checked_sum(from(ints, i)); });
+
+        setIsa(isa::scalar);
+        measure("  checked_sum (int8, scalar):   ", [&](std::size_t i) { return checked_sum(from(bytes, i)); });
+        setIsa(isa::avx2);
+        measure("  checked_sum (int8, AVX2):     ", [&](std::size_t i) { return checked_sum(from(bytes, i)); });
+
+        setIsa(isa::scalar);
+        measure("  checked_sum (int64, scalar):  ", [&](std::size_t i) { return checked_sum(from(longs, i)); });
+        setIsa(isa::avx2);
+        measure("  checked_sum (int64, AVX2):    ", [&](std::size_t i) { return checked_sum(from(longs, i)); });
+    }
+}
+
+void example_numeric_kernels()
+{
+    using namespace NumericKernels;
+
+    numeric_kernels_01();
+    numeric_kernels_02_accuracy();
+    numeric_kernels_03_throughput();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
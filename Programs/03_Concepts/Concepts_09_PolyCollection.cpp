@@ -0,0 +1,355 @@
+// ===========================================================================
+// Concepts_09_PolyCollection.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <concepts>
+#include <type_traits>
+#include <typeinfo>
+#include <typeindex>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <random>
+#include <string>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+#include "Helpers.h"
+
+namespace PolyCollection {
+
+    // =======================================================================
+    // poly_collection: objects of different types satisfying the same concept,
+    // stored by value in one contiguous segment per type.
+    //
+    // The type of the operation 'TOp' is part of the collection type, its call
+    // operator is constrained by a concept: only objects satisfying it can be
+    // inserted. A segment is type-erased (one virtual call per segment),
+    // the loop over the elements of a segment knows their type - the calls
+    // of the operation can be inlined. The segments themselves are stored
+    // in a small buffer inside their slot, not on the heap.
+
+    template <typename TOp>
+    class poly_collection
+    {
+    private:
+        class segment_base
+        {
+        public:
+            virtual ~segment_base() = default;
+
+            virtual std::type_index type() const = 0;
+            virtual std::size_t size() const = 0;
+            virtual void for_each(TOp& op) const = 0;
+
+            // move constructs the segment into another slot
+            virtual segment_base* move_to(void* buffer) noexcept = 0;
+        };
+
+        template <typename T>
+        class segment : public segment_base
+        {
+        private:
+            std::vector<T> m_elements;
+
+        public:
+            std::type_index type() const override { return typeid(T); }
+            std::size_t size() const override { return m_elements.size(); }
+
+            void for_each(TOp& op) const override
+            {
+                for (const T& elem : m_elements) {
+                    op(elem);
+                }
+            }
+
+            template <typename... TArgs>
+            void emplace(TArgs&&... args)
+            {
+                m_elements.emplace_back(std::forward<TArgs>(args)...);
+            }
+
+            void reserve(std::size_t count) { m_elements.reserve(count); }
+
+            segment_base* move_to(void* buffer) noexcept override
+            {
+                return ::new (buffer) segment{ std::move(*this) };
+            }
+        };
+
+        // small buffer for one segment: a vtable pointer and a std::vector,
+        // whatever the element type is
+        class segment_slot
+        {
+        private:
+            static constexpr std::size_t BufferSize{ 8 * sizeof(void*) };
+
+            alignas(std::max_align_t) std::byte m_buffer[BufferSize];
+            segment_base* m_segment;
+
+        public:
+            template <typename T>
+            explicit segment_slot(std::in_place_type_t<T>)
+            {
+                static_assert(sizeof(segment<T>) <= BufferSize && alignof(segment<T>) <= alignof(std::max_align_t));
+                m_segment = ::new (m_buffer) segment<T>{};
+            }
+
+            segment_slot(segment_slot&& other) noexcept : m_segment{ other.m_segment->move_to(m_buffer) } {}
+
+            segment_slot& operator= (segment_slot&&) = delete;
+
+            ~segment_slot() { m_segment->~segment_base(); }
+
+            segment_base& operator* () const { return *m_segment; }
+            segment_base* operator-> () const { return m_segment; }
+        };
+
+        std::vector<segment_slot> m_segments;
+
+        template <typename T>
+        segment<T>& segmentOf()
+        {
+            for (const auto& seg : m_segments) {
+                if (seg->type() == typeid(T)) {
+                    return static_cast<segment<T>&>(*seg);
+                }
+            }
+
+            m_segments.emplace_back(std::in_place_type<T>);
+            return static_cast<segment<T>&>(*m_segments.back());
+        }
+
+    public:
+        template <typename T, typename... TArgs>
+            requires std::invocable<TOp&, const T&> && std::constructible_from<T, TArgs...>
+        void emplace(TArgs&&... args)
+        {
+            segmentOf<T>().emplace(std::forward<TArgs>(args)...);
+        }
+
+        template <typename T>
+            requires std::invocable<TOp&, const std::remove_cvref_t<T>&>
+        void insert(T&& value)
+        {
+            segmentOf<std::remove_cvref_t<T>>().emplace(std::forward<T>(value));
+        }
+
+        template <typename T>
+            requires std::invocable<TOp&, const T&>
+        void reserve(std::size_t count)
+        {
+            segmentOf<T>().reserve(count);
+        }
+
+        std::size_t size() const
+        {
+            std::size_t count{};
+            for (const auto& seg : m_segments) {
+                count += seg->size();
+            }
+            return count;
+        }
+
+        std::size_t segments() const { return m_segments.size(); }
+
+        void clear() { m_segments.clear(); }
+
+        // segment by segment: the elements are visited grouped by type,
+        // not in the order of insertion
+        TOp& for_each(TOp& op) const
+        {
+            for (const auto& seg : m_segments) {
+                seg->for_each(op);
+            }
+            return op;
+        }
+
+        TOp for_each(TOp&& op = {}) const
+        {
+            for_each(op);
+            return std::move(op);
+        }
+    };
+
+    // =======================================================================
+    // greeters (Concepts_01_Overview.cpp)
+
+    template <typename G>
+    concept Greeter = requires(G g)
+    {
+        { g.say_hi() } -> std::convertible_to<void>;
+    };
+
+    struct SpanishGreeter
+    {
+        void say_hi() const {
+            std::cout << "Hola amigos" << std::endl;
+        }
+    };
+
+    struct EnglishGreeter
+    {
+        void say_hi() const {
+            std::cout << "Hello my friends" << std::endl;
+        }
+    };
+
+    struct ItalianGreeter
+    {
+        void say_hi() const {
+            std::cout << "Ciao Ragazzi" << std::endl;
+        }
+    };
+
+    // the operation: constrained by the concept Greeter
+    struct say_hi
+    {
+        template <Greeter G>
+        void operator()(const G& greeter) const
+        {
+            greeter.say_hi();
+        }
+    };
+
+    void poly_collection_01()
+    {
+        poly_collection<say_hi> greeters;
+
+        greeters.insert(SpanishGreeter{});
+        greeters.insert(EnglishGreeter{});
+        greeters.insert(ItalianGreeter{});
+        greeters.insert(EnglishGreeter{});
+        // greeters.insert(42);    // error: the associated constraints are not satisfied
+
+        std::cout << greeters.size() << " greeters in " << greeters.segments() << " segments:" << std::endl;
+        greeters.for_each();
+    }
+
+    // =======================================================================
+    // benchmark: sum of the areas of 10^7 shapes
+
+    template <typename S>
+    concept Shape = requires(const S & s)
+    {
+        { s.area() } -> std::convertible_to<double>;
+    };
+
+    struct Circle
+    {
+        double m_radius;
+        double area() const { return 3.14159265358979 * m_radius * m_radius; }
+    };
+
+    struct Rectangle
+    {
+        double m_width;
+        double m_height;
+        double area() const { return m_width * m_height; }
+    };
+
+    struct Triangle
+    {
+        double m_base;
+        double m_height;
+        double area() const { return 0.5 * m_base * m_height; }
+    };
+
+    struct total_area
+    {
+        double m_sum{};
+
+        template <Shape S>
+        void operator()(const S& shape)
+        {
+            m_sum += shape.area();
+        }
+    };
+
+    // classic object-oriented counterpart
+    class ShapeBase
+    {
+    public:
+        virtual ~ShapeBase() = default;
+        virtual double area() const = 0;
+    };
+
+    template <Shape S>
+    class ShapeObject : public ShapeBase
+    {
+    private:
+        S m_shape;
+
+    public:
+        explicit ShapeObject(const S& shape) : m_shape{ shape } {}
+        double area() const override { return m_shape.area(); }
+    };
+
+    using Helpers::measure;
+
+    void poly_collection_02_benchmark()
+    {
+        constexpr std::size_t Count{ 10'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> kind{ 0, 2 };
+        std::uniform_real_distribution<double> length{ 0.5, 2.0 };
+
+        std::vector<std::unique_ptr<ShapeBase>> objects;
+        objects.reserve(Count);
+
+        poly_collection<total_area> shapes;
+
+        for (std::size_t i{}; i != Count; ++i) {
+            const double a{ length(generator) };
+            const double b{ length(generator) };
+
+            switch (kind(generator)) {
+            case 0:
+                objects.push_back(std::make_unique<ShapeObject<Circle>>(Circle{ a }));
+                shapes.insert(Circle{ a });
+                break;
+            case 1:
+                objects.push_back(std::make_unique<ShapeObject<Rectangle>>(Rectangle{ a, b }));
+                shapes.insert(Rectangle{ a, b });
+                break;
+            default:
+                objects.push_back(std::make_unique<ShapeObject<Triangle>>(Triangle{ a, b }));
+                shapes.insert(Triangle{ a, b });
+                break;
+            }
+        }
+
+        // objects allocated one after another lie next to each other in memory -
+        // in a real program the heap is fragmented
+        std::ranges::shuffle(objects, generator);
+
+        std::cout << Count << " shapes:" << std::endl;
+
+        measure("  vector<unique_ptr<ShapeBase>>: ", [&] {
+            double sum{};
+            for (const auto& object : objects) {
+                sum += object->area();
+            }
+            return sum;
+        });
+
+        measure("  poly_collection<total_area>:   ", [&] {
+            return shapes.for_each().m_sum;
+        });
+    }
+}
+
+void example_poly_collection()
+{
+    using namespace PolyCollection;
+
+    poly_collection_01();
+    poly_collection_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -0,0 +1,381 @@
+// ===========================================================================
+// Concepts_10_ParallelReduce.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <concepts>
+#include <type_traits>
+#include <ranges>
+#include <iterator>
+#include <vector>
+#include <array>
+#include <optional>
+#include <numeric>
+#include <algorithm>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <exception>
+#include <random>
+#include <string>
+
+#include "Helpers.h"
+
+namespace ParallelReduce {
+
+    // -----------------------------------------------------------------------
+    // concept (Concepts_01_Overview.cpp)
+
+    template <typename T, typename U = T>
+    concept Sumable2 =
+    requires(T a, U b)
+    {
+        { a + b };
+        { b + a };
+    }
+    && requires(std::ostream& os, const T& a)
+    {
+        { os << a };
+    };
+
+    // -----------------------------------------------------------------------
+    // parallel tree reduction
+    //
+    // The operator + must be associative, it need not be commutative:
+    // the order of the elements is preserved, no identity element is needed.
+    //
+    //   * small, trivially copyable types (int, double, Adder):
+    //     eight independent accumulators over contiguous sub-blocks - the
+    //     dependency chain of the additions is broken, the compiler can
+    //     vectorize the loop. Up to 64K elements per thread this runs on the
+    //     calling thread only
+    //   * other types (e.g. std::string): a plain left fold per block,
+    //     blocks are smaller, the costs of an addition dominate
+    //
+    // Larger ranges are split into blocks, which are executed by a thread
+    // pool (created once) and the calling thread. The partial results of the
+    // blocks are combined pairwise (tree). An exception thrown by operator +
+    // is rethrown on the calling thread.
+
+    template <typename T>
+    constexpr bool Vectorizable = std::is_trivially_copyable_v<T> && sizeof(T) <= 32;
+
+    namespace details {
+
+        constexpr std::size_t Lanes{ 8 };
+
+        template <typename T>
+        constexpr std::size_t MinimumPerThread{ Vectorizable<T> ? 64 * 1024 : 1024 };
+
+        template <typename T, typename TIter>
+        T foldLeft(TIter first, std::size_t count)
+        {
+            T result{ first[0] };
+            for (std::size_t i{ 1 }; i != count; ++i) {
+                result = std::move(result) + first[i];
+            }
+            return result;
+        }
+
+        template <typename T, typename TIter, std::size_t... Is>
+        std::array<T, sizeof...(Is)> makeLanes(TIter first, std::size_t laneSize, std::index_sequence<Is...>)
+        {
+            return { static_cast<T>(first[Is * laneSize])... };
+        }
+
+        // eight contiguous sub-blocks in lockstep, combined in order
+        template <typename T, typename TIter>
+        T foldLanes(TIter first, std::size_t count)
+        {
+            const std::size_t laneSize{ count / Lanes };
+
+            if (laneSize < 2) {
+                return foldLeft<T>(first, count);
+            }
+
+            std::array<T, Lanes> acc{ makeLanes<T>(first, laneSize, std::make_index_sequence<Lanes>{}) };
+
+            for (std::size_t i{ 1 }; i != laneSize; ++i) {
+                for (std::size_t k{}; k != Lanes; ++k) {
+                    acc[k] = acc[k] + first[k * laneSize + i];
+                }
+            }
+
+            T result{ acc[0] };
+            for (std::size_t k{ 1 }; k != Lanes; ++k) {
+                result = result + acc[k];
+            }
+
+            // remainder
+            for (std::size_t i{ Lanes * laneSize }; i != count; ++i) {
+                result = result + first[i];
+            }
+
+            return result;
+        }
+
+        template <typename T, typename TIter>
+        T foldBlock(TIter first, std::size_t count)
+        {
+            if constexpr (Vectorizable<T>) {
+                return foldLanes<T>(first, count);
+            }
+            else {
+                return foldLeft<T>(first, count);
+            }
+        }
+
+        // fixed number of worker threads, one queue of tasks
+        class thread_pool
+        {
+        private:
+            std::mutex                        m_mutex;
+            std::condition_variable           m_wakeup;
+            std::deque<std::function<void()>> m_tasks;
+            bool                              m_stop;
+            std::vector<std::jthread>         m_workers;   // last member: joined first
+
+        public:
+            explicit thread_pool(std::size_t threads) : m_stop{}
+            {
+                m_workers.reserve(threads);
+                for (std::size_t i{}; i != threads; ++i) {
+                    m_workers.emplace_back([this] { work(); });
+                }
+            }
+
+            ~thread_pool()
+            {
+                {
+                    std::lock_guard lock{ m_mutex };
+                    m_stop = true;
+                }
+                m_wakeup.notify_all();
+            }
+
+            // worker threads plus the calling thread
+            std::size_t concurrency() const { return m_workers.size() + 1; }
+
+            void submit(std::function<void()> task)
+            {
+                {
+                    std::lock_guard lock{ m_mutex };
+                    m_tasks.push_back(std::move(task));
+                }
+                m_wakeup.notify_one();
+            }
+
+            // a waiting thread executes queued tasks in the meantime
+            bool tryRunOne()
+            {
+                std::function<void()> task{};
+                {
+                    std::lock_guard lock{ m_mutex };
+                    if (m_tasks.empty()) {
+                        return false;
+                    }
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+                task();
+                return true;
+            }
+
+            static thread_pool& instance()
+            {
+                static thread_pool pool{ std::max(std::thread::hardware_concurrency(), 1u) - 1 };
+                return pool;
+            }
+
+        private:
+            void work()
+            {
+                while (true) {
+                    std::function<void()> task{};
+                    {
+                        std::unique_lock lock{ m_mutex };
+                        m_wakeup.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                        if (m_tasks.empty()) {
+                            return;
+                        }
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+        };
+
+        // pairwise, neighbours only: the order is preserved
+        template <typename T>
+        T combineTree(std::vector<std::optional<T>>& partials)
+        {
+            for (std::size_t step{ 1 }; step < partials.size(); step *= 2) {
+                for (std::size_t i{}; i + step < partials.size(); i += 2 * step) {
+                    partials[i] = std::move(*partials[i]) + *partials[i + step];
+                }
+            }
+            return std::move(*partials[0]);
+        }
+    }
+
+    template <std::ranges::random_access_range R>
+        requires std::ranges::sized_range<R> && Sumable2<std::ranges::range_value_t<R>>
+    std::ranges::range_value_t<R> reduce(R&& range, std::ranges::range_value_t<R> init, std::size_t threads = 0)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        const std::size_t size{ std::ranges::size(range) };
+        if (size == 0) {
+            return init;
+        }
+
+        const auto first{ std::ranges::begin(range) };
+
+        details::thread_pool& pool{ details::thread_pool::instance() };
+
+        if (threads == 0) {
+            threads = pool.concurrency();
+        }
+        const std::size_t blocks{ std::clamp(size / details::MinimumPerThread<T>, std::size_t{ 1 }, threads) };
+
+        if (blocks == 1) {
+            return std::move(init) + details::foldBlock<T>(first, size);
+        }
+
+        std::vector<std::optional<T>> partials(blocks);
+        std::atomic<std::size_t> pending{ blocks - 1 };
+        std::mutex mutex{};
+        std::exception_ptr error{};
+
+        auto work = [&](std::size_t t) {
+            try {
+                const std::size_t begin{ size * t / blocks };
+                const std::size_t end{ size * (t + 1) / blocks };
+                partials[t] = details::foldBlock<T>(first + begin, end - begin);
+            }
+            catch (...) {
+                std::lock_guard lock{ mutex };
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+
+        for (std::size_t t{ 1 }; t != blocks; ++t) {
+            pool.submit([&, t] {
+                work(t);
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    pending.notify_all();
+                }
+            });
+        }
+        work(0);
+
+        // the blocks refer to local variables: wait for all of them
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (!pool.tryRunOne()) {
+                const std::size_t current{ pending.load(std::memory_order_acquire) };
+                if (current != 0) {
+                    pending.wait(current, std::memory_order_acquire);
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        return std::move(init) + details::combineTree(partials);
+    }
+
+    // -----------------------------------------------------------------------
+    // user-defined type (Concepts_01_Overview.cpp)
+
+    class Adder
+    {
+    private:
+        int m_value{};
+
+    public:
+        Adder(int value) : m_value{ value } {}
+
+        Adder operator+(const Adder& other) const
+        {
+            return { m_value + other.m_value };
+        }
+
+        int operator()() const { return m_value; }
+    };
+
+    std::ostream& operator<<(std::ostream& os, const Adder& n)
+    {
+        os << n();
+        return os;
+    }
+
+    static_assert(Sumable2<Adder> && Vectorizable<Adder>);
+    static_assert(Sumable2<std::string> && !Vectorizable<std::string>);
+
+    void parallel_reduce_01()
+    {
+        std::vector<int> numbers(100);
+        std::iota(numbers.begin(), numbers.end(), 1);
+        std::cout << "reduce (int):    " << reduce(numbers, 0) << std::endl;
+
+        std::vector<Adder> adders{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        std::cout << "reduce (Adder):  " << reduce(adders, Adder{ 0 }) << std::endl;
+
+        // not commutative: the order is preserved
+        std::vector<std::string> words{ "Concepts", " ", "and", " ", "parallel", " ", "reduction" };
+        std::cout << "reduce (string): " << reduce(words, std::string{ ">> " }, 3) << std::endl;
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark
+
+    using Helpers::measure;
+
+    void parallel_reduce_02_benchmark()
+    {
+        constexpr std::size_t Count{ 20'000'000 };
+
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> distribution{ 0, 9 };
+
+        std::vector<int> ints(Count);
+        for (auto& value : ints) {
+            value = distribution(generator);
+        }
+
+        std::vector<double> reals(ints.begin(), ints.end());
+        std::vector<Adder> adders(ints.begin(), ints.end());
+
+        std::cout << Count << " elements, " << std::thread::hardware_concurrency() << " threads:" << std::endl;
+
+        measure("  std::accumulate (int):    ", [&] { return std::accumulate(ints.begin(), ints.end(), 0); });
+        measure("  reduce (int):             ", [&] { return reduce(ints, 0); });
+
+        measure("  std::accumulate (double): ", [&] { return std::accumulate(reals.begin(), reals.end(), 0.0); });
+        measure("  reduce (double):          ", [&] { return reduce(reals, 0.0); });
+
+        measure("  std::accumulate (Adder):  ", [&] { return std::accumulate(adders.begin(), adders.end(), Adder{ 0 }); });
+        measure("  reduce (Adder):           ", [&] { return reduce(adders, Adder{ 0 }); });
+    }
+}
+
+void example_parallel_reduce()
+{
+    using namespace ParallelReduce;
+
+    parallel_reduce_01();
+    parallel_reduce_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
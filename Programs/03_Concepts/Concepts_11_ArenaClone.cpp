@@ -0,0 +1,413 @@
+// ===========================================================================
+// Concepts_11_ArenaClone.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <concepts>
+#include <type_traits>
+#include <memory>
+#include <new>
+#include <vector>
+#include <span>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "Helpers.h"
+
+namespace ArenaClone {
+
+    // -----------------------------------------------------------------------
+    // concept (Concepts_02_MoreDetails.cpp)
+
+    template<typename C>
+    concept Clonable = requires (C clonable) {
+        clonable.clone();
+        requires std::same_as<C, decltype(clonable.clone())>;
+    };
+
+    // =======================================================================
+    // arena: monotonic memory resource, memory is handed out by moving
+    // a pointer forward. Memory isn't released per object, reset() rewinds
+    // the arena and keeps its chunks for the next round (e.g. the next snapshot).
+    // Destructors of objects that aren't trivially destructible are registered
+    // and called by reset() and by the destructor of the arena.
+
+    class arena
+    {
+    private:
+        struct chunk
+        {
+            std::unique_ptr<std::byte[]> m_data;
+            std::size_t                  m_size;
+        };
+
+        struct cleanup
+        {
+            void*       m_objects;
+            std::size_t m_count;
+            void (*m_destroy)(void*, std::size_t);
+        };
+
+        std::size_t          m_chunkSize;
+        std::vector<chunk>   m_chunks;
+        std::size_t          m_current;     // index of the chunk in use
+        std::byte*           m_pos;
+        std::byte*           m_end;
+        std::vector<cleanup> m_cleanups;
+
+    public:
+        static constexpr std::size_t DefaultChunkSize{ 1024 * 1024 };
+
+        explicit arena(std::size_t chunkSize = DefaultChunkSize)
+            : m_chunkSize{ chunkSize }, m_chunks{}, m_current{}, m_pos{}, m_end{}, m_cleanups{}
+        {}
+
+        arena(const arena&) = delete;
+        arena& operator= (const arena&) = delete;
+
+        ~arena()
+        {
+            destroyObjects();
+        }
+
+        void* allocate(std::size_t bytes, std::size_t alignment)
+        {
+            if (m_pos == nullptr || padding(m_pos, alignment) + bytes > static_cast<std::size_t>(m_end - m_pos)) {
+                nextChunk(bytes + alignment);
+            }
+
+            std::byte* pos{ m_pos + padding(m_pos, alignment) };
+            m_pos = pos + bytes;
+            return pos;
+        }
+
+        template <typename T>
+        T* allocate(std::size_t count = 1)
+        {
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        // if the registration fails, the objects are destroyed immediately
+        template <typename T>
+        void register_destructor(T* objects, std::size_t count = 1)
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                try {
+                    m_cleanups.push_back({ objects, count, [](void* first, std::size_t n) {
+                        std::destroy_n(static_cast<T*>(first), n);
+                    } });
+                }
+                catch (...) {
+                    std::destroy_n(objects, count);
+                    throw;
+                }
+            }
+        }
+
+        void reset()
+        {
+            destroyObjects();
+
+            m_current = 0;
+            if (!m_chunks.empty()) {
+                m_pos = m_chunks[0].m_data.get();
+                m_end = m_pos + m_chunks[0].m_size;
+            }
+        }
+
+        std::size_t capacity() const
+        {
+            std::size_t bytes{};
+            for (const auto& c : m_chunks) {
+                bytes += c.m_size;
+            }
+            return bytes;
+        }
+
+    private:
+        // bytes to skip up to the next multiple of 'alignment' (a power of 2)
+        static std::size_t padding(const std::byte* pos, std::size_t alignment)
+        {
+            const auto address{ reinterpret_cast<std::uintptr_t>(pos) };
+            return static_cast<std::size_t>(-address & (alignment - 1));
+        }
+
+        // next chunk with enough space - an existing one after reset() or a new one
+        void nextChunk(std::size_t bytes)
+        {
+            std::size_t next{ m_pos == nullptr ? 0 : m_current + 1 };
+
+            while (next < m_chunks.size() && m_chunks[next].m_size < bytes) {
+                ++next;
+            }
+
+            if (next == m_chunks.size()) {
+                const std::size_t size{ std::max(m_chunkSize, bytes) };
+                m_chunks.push_back({ std::make_unique_for_overwrite<std::byte[]>(size), size });
+            }
+
+            m_current = next;
+            m_pos = m_chunks[next].m_data.get();
+            m_end = m_pos + m_chunks[next].m_size;
+        }
+
+        void destroyObjects()
+        {
+            for (auto it{ m_cleanups.rbegin() }; it != m_cleanups.rend(); ++it) {
+                it->m_destroy(it->m_objects, it->m_count);
+            }
+            m_cleanups.clear();
+        }
+    };
+
+    // =======================================================================
+    // cloning into an arena
+    //
+    //   * ArenaClonable: the type clones itself into the given storage of the
+    //     arena, the objects it references (e.g. a part of an object graph)
+    //     are cloned into the arena as well
+    //   * bitwise: one memcpy, for a whole container as well. Opt-in: only a
+    //     trivially copyable type whose clone() is known to return a copy
+    //     (it could return a fresh object as well) specializes enable_bitwise_clone
+    //   * otherwise: the result of clone() is moved into the arena
+
+    template <typename C>
+    constexpr bool enable_bitwise_clone = false;
+
+    template <typename C>
+    concept ArenaClonable = Clonable<C> && requires (C clonable, arena & a, void* storage) {
+        { clonable.clone_into(a, storage) } -> std::same_as<C*>;
+    };
+
+    template <typename C>
+    concept BitwiseClonable = Clonable<C> && enable_bitwise_clone<C> &&
+        std::is_trivially_copyable_v<C> && !ArenaClonable<C>;
+
+    template <Clonable C>
+    C* clone_into(arena& a, C& object)
+    {
+        if constexpr (ArenaClonable<C>) {
+            C* copy{ object.clone_into(a, a.allocate<C>()) };
+            a.register_destructor(copy);
+            return copy;
+        }
+        else if constexpr (BitwiseClonable<C>) {
+            C* copy{ a.allocate<C>() };
+            std::memcpy(static_cast<void*>(copy), std::addressof(object), sizeof(C));
+            return copy;
+        }
+        else {
+            C* copy{ ::new (a.allocate<C>()) C{ object.clone() } };
+            a.register_destructor(copy);
+            return copy;
+        }
+    }
+
+    // all objects in one contiguous block of the arena: locality is kept.
+    // Each object is constructed at its final place; if a clone throws,
+    // the objects constructed so far are destroyed again
+    template <Clonable C>
+    std::span<C> clone_batch(arena& a, std::span<C> objects)
+    {
+        C* copies{ a.allocate<C>(objects.size()) };
+
+        if constexpr (BitwiseClonable<C>) {
+            if (!objects.empty()) {
+                std::memcpy(static_cast<void*>(copies), objects.data(), objects.size_bytes());
+            }
+        }
+        else {
+            std::size_t constructed{};
+
+            try {
+                for (; constructed != objects.size(); ++constructed) {
+                    if constexpr (ArenaClonable<C>) {
+                        objects[constructed].clone_into(a, copies + constructed);
+                    }
+                    else {
+                        ::new (copies + constructed) C{ objects[constructed].clone() };
+                    }
+                }
+            }
+            catch (...) {
+                std::destroy_n(copies, constructed);
+                throw;
+            }
+
+            a.register_destructor(copies, objects.size());
+        }
+
+        return { copies, objects.size() };
+    }
+
+    // =======================================================================
+    // examples
+
+    // unlike the stateless Droid of Concepts_02_MoreDetails.cpp, whose clone()
+    // creates a fresh object, this droid has a state - a clone is a copy
+    struct Droid {
+        int    m_id;
+        double m_x;
+        double m_y;
+        double m_energy;
+
+        Droid clone() {
+            return *this;
+        }
+    };
+
+    template <>
+    constexpr bool enable_bitwise_clone<Droid> = true;
+
+    // Concepts_02_MoreDetails.cpp: trivially copyable, but clone() doesn't copy
+    struct FreshDroid {
+        int m_id;
+
+        FreshDroid clone() {
+            return FreshDroid{};
+        }
+    };
+
+    // not trivially copyable
+    struct NamedDroid {
+        std::string m_name;
+        Droid       m_droid;
+
+        NamedDroid clone() {
+            return { m_name, m_droid.clone() };
+        }
+    };
+
+    // part of an object graph: the leader is cloned as well
+    struct Squad {
+        Droid* m_leader;
+        int    m_size;
+
+        Squad clone() {
+            return *this;       // shallow: shares the leader
+        }
+
+        Squad* clone_into(arena& a, void* storage) {
+            Droid* leader{ ArenaClone::clone_into(a, *m_leader) };
+            return ::new (storage) Squad{ leader, m_size };
+        }
+    };
+
+    static_assert(BitwiseClonable<Droid>);
+    static_assert(Clonable<FreshDroid> && std::is_trivially_copyable_v<FreshDroid> && !BitwiseClonable<FreshDroid>);
+    static_assert(Clonable<NamedDroid> && !BitwiseClonable<NamedDroid>);
+    static_assert(ArenaClonable<Squad> && !BitwiseClonable<Squad>);
+
+    void arena_clone_01()
+    {
+        arena a;
+
+        Droid r2d2{ 1, 1.0, 2.0, 100.0 };
+        Droid* copy{ clone_into(a, r2d2) };
+        std::cout << "Droid " << copy->m_id << " at (" << copy->m_x << ',' << copy->m_y << ')' << std::endl;
+
+        FreshDroid fresh{ 42 };
+        std::cout << "FreshDroid clone: " << clone_into(a, fresh)->m_id << std::endl;     // 0: clone() was called
+
+        std::vector<NamedDroid> droids{ { "R2-D2", { 1, 1.0, 2.0, 100.0 } }, { "C-3PO", { 2, 3.0, 4.0, 80.0 } } };
+        std::span<NamedDroid> snapshot{ clone_batch(a, std::span{ droids }) };
+
+        droids[0].m_name = "changed";
+
+        for (const auto& droid : snapshot) {
+            std::cout << droid.m_name << ": " << droid.m_droid.m_energy << std::endl;
+        }
+
+        Droid leader{ 3, 0.0, 0.0, 50.0 };
+        Squad squad{ &leader, 12 };
+        Squad* squadCopy{ clone_into(a, squad) };
+        leader.m_energy = 0.0;
+        std::cout << "Squad of " << squadCopy->m_size << ", leader energy: " << squadCopy->m_leader->m_energy << std::endl;
+
+        a.reset();      // calls the destructors of the NamedDroid objects
+    }
+
+    // =======================================================================
+    // benchmark: 10 snapshots of 10^6 objects
+
+    using Helpers::measure;
+
+    void arena_clone_02_benchmark()
+    {
+        constexpr std::size_t Count{ 1'000'000 };
+        constexpr std::size_t Snapshots{ 10 };
+
+        std::vector<Droid> droids(Count);
+        for (std::size_t i{}; i != Count; ++i) {
+            droids[i] = { static_cast<int>(i), 0.5 * i, 0.25 * i, 100.0 };
+        }
+
+        std::cout << Snapshots << " snapshots of " << Count << " objects:" << std::endl;
+
+        measure("  vector<unique_ptr<Droid>>: ", [&] {
+            double checksum{};
+            for (std::size_t s{}; s != Snapshots; ++s) {
+                std::vector<std::unique_ptr<Droid>> snapshot;
+                snapshot.reserve(Count);
+                for (auto& droid : droids) {
+                    snapshot.push_back(std::make_unique<Droid>(droid.clone()));
+                }
+                checksum += snapshot[s]->m_x;
+            }
+            return checksum;
+        });
+
+        measure("  vector<Droid> (clone):     ", [&] {
+            double checksum{};
+            for (std::size_t s{}; s != Snapshots; ++s) {
+                std::vector<Droid> snapshot;
+                snapshot.reserve(Count);
+                for (auto& droid : droids) {
+                    snapshot.push_back(droid.clone());
+                }
+                checksum += snapshot[s].m_x;
+            }
+            return checksum;
+        });
+
+        arena a;
+
+        measure("  clone_into (arena):        ", [&] {
+            double checksum{};
+            std::vector<Droid*> snapshot(Count);
+            for (std::size_t s{}; s != Snapshots; ++s) {
+                a.reset();
+                for (std::size_t i{}; i != Count; ++i) {
+                    snapshot[i] = clone_into(a, droids[i]);
+                }
+                checksum += snapshot[s]->m_x;
+            }
+            return checksum;
+        });
+
+        measure("  clone_batch (arena):       ", [&] {
+            double checksum{};
+            for (std::size_t s{}; s != Snapshots; ++s) {
+                a.reset();
+                std::span<Droid> snapshot{ clone_batch(a, std::span{ droids }) };
+                checksum += snapshot[s].m_x;
+            }
+            return checksum;
+        });
+    }
+}
+
+void example_arena_clone()
+{
+    using namespace ArenaClone;
+
+    arena_clone_01();
+    arena_clone_02_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -7,6 +7,12 @@ void example_more_details();
 void example_requires_clause_vs_requires_expression();
 void example_more_examples();
 void example_exercises();
+void example_string_concat();
+void example_serialization();
+void example_numeric_kernels();
+void example_poly_collection();
+void example_parallel_reduce();
+void example_arena_clone();
 
 int main()
 {
@@ -15,6 +21,12 @@ int main()
     example_requires_clause_vs_requires_expression();
     example_more_examples();
     example_exercises();
+    example_string_concat();
+    example_serialization();
+    example_numeric_kernels();
+    example_poly_collection();
+    example_parallel_reduce();
+    example_arena_clone();
 
     return 0;
 }
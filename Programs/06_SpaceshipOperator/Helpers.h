@@ -0,0 +1,39 @@
+// ===========================================================================
+// Helpers.h // helpers shared by the benchmarks
+// ===========================================================================
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <utility>
+
+namespace Helpers
+{
+    // calls func once, returns its result and the elapsed time
+    template <typename TFunc>
+    auto stopwatch(TFunc&& func)
+    {
+        const auto begin{ std::chrono::steady_clock::now() };
+        auto result{ std::forward<TFunc>(func)() };
+        const auto end{ std::chrono::steady_clock::now() };
+
+        return std::pair{ std::move(result), end - begin };
+    }
+
+    // func returns a result of its work: the optimizer can't drop the work
+    template <typename TFunc>
+    void measure(const std::string& label, TFunc&& func)
+    {
+        const auto [result, elapsed] { stopwatch(std::forward<TFunc>(func)) };
+
+        std::cout << label
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+            << " msecs (" << result << ")" << std::endl;
+    }
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
@@ -3,10 +3,18 @@
 // ===========================================================================
 
 void test_spaceship_operator();
+void test_spaceship_rational();
+void test_spaceship_packed_key();
+void test_spaceship_flat_set();
+void test_spaceship_lexicographic();
 
 int main()
 {
     test_spaceship_operator();
+    test_spaceship_rational();
+    test_spaceship_packed_key();
+    test_spaceship_flat_set();
+    test_spaceship_lexicographic();
     return 0;
 }
 
@@ -0,0 +1,382 @@
+// ===========================================================================
+// SpaceshipOperator_05_Rational.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <string>
+#include <compare>
+#include <set>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#include "Helpers.h"
+
+namespace Spaceship_05_Rational
+{
+    // -----------------------------------------------------------------------
+    // class Fraction (SpaceshipOperator.cpp, namespace Spaceship_04_Operator_Fraction)
+
+    namespace Reference
+    {
+        class Fraction
+        {
+        private:
+            int m_num;
+            int m_denom;
+
+        public:
+            Fraction() : m_num{ 0 }, m_denom{ 1 } { };
+            Fraction(int num, int denom) : m_num(num), m_denom(denom) { };
+
+            bool operator==(const Fraction& other) const = default;
+
+            std::strong_ordering operator<=>(const Fraction& other) const {
+
+                if (m_num == other.m_num && m_denom == other.m_denom) {
+                    return std::strong_ordering::equal;
+                }
+
+                if (m_num * other.m_denom < m_denom * other.m_num)
+                {
+                    return std::strong_ordering::less;
+                }
+                else {
+                    return std::strong_ordering::greater;
+                }
+            }
+
+            friend std::ostream& operator<< (std::ostream& os, const Fraction& f)
+            {
+                os << f.m_num << '/' << f.m_denom;
+                return os;
+            }
+        };
+
+        // Fraction with an overflow-safe comparison: the cross products are
+        // computed with 64 bits and compared with branches (positive denominators).
+        // Equal values with different representations are equivalent,
+        // the ordering is a std::weak_ordering
+        class SafeFraction
+        {
+        private:
+            int m_num;
+            int m_denom;
+
+        public:
+            SafeFraction() : m_num{ 0 }, m_denom{ 1 } { };
+            SafeFraction(int num, int denom) : m_num(num), m_denom(denom) { };
+
+            std::weak_ordering operator<=>(const SafeFraction& other) const {
+
+                const std::int64_t lhs{ std::int64_t{ m_num } * other.m_denom };
+                const std::int64_t rhs{ std::int64_t{ other.m_num } * m_denom };
+
+                if (lhs < rhs) {
+                    return std::weak_ordering::less;
+                }
+                else if (lhs > rhs) {
+                    return std::weak_ordering::greater;
+                }
+                else {
+                    return std::weak_ordering::equivalent;
+                }
+            }
+
+            friend std::ostream& operator<< (std::ostream& os, const SafeFraction& f)
+            {
+                os << f.m_num << '/' << f.m_denom;
+                return os;
+            }
+        };
+    }
+
+    // -----------------------------------------------------------------------
+    // signed 64 x 64 => 128 bit multiplication
+
+    struct Int128
+    {
+        std::int64_t  m_high;
+        std::uint64_t m_low;
+    };
+
+    inline Int128 multiply(std::int64_t a, std::int64_t b)
+    {
+#if defined(__SIZEOF_INT128__)
+        const __int128 product{ static_cast<__int128>(a) * b };
+        return { static_cast<std::int64_t>(product >> 64), static_cast<std::uint64_t>(product) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+        std::int64_t high{};
+        const std::int64_t low{ _mul128(a, b, &high) };
+        return { high, static_cast<std::uint64_t>(low) };
+#else
+        // unsigned product of the four 32-bit halves ...
+        const std::uint64_t ua{ static_cast<std::uint64_t>(a) };
+        const std::uint64_t ub{ static_cast<std::uint64_t>(b) };
+
+        const std::uint64_t aLow{ ua & 0xFFFF'FFFF }, aHigh{ ua >> 32 };
+        const std::uint64_t bLow{ ub & 0xFFFF'FFFF }, bHigh{ ub >> 32 };
+
+        const std::uint64_t ll{ aLow * bLow };
+        const std::uint64_t lh{ aLow * bHigh };
+        const std::uint64_t hl{ aHigh * bLow };
+        const std::uint64_t hh{ aHigh * bHigh };
+
+        const std::uint64_t middle{ (ll >> 32) + (lh & 0xFFFF'FFFF) + (hl & 0xFFFF'FFFF) };
+
+        const std::uint64_t low{ (middle << 32) | (ll & 0xFFFF'FFFF) };
+        std::uint64_t high{ hh + (lh >> 32) + (hl >> 32) + (middle >> 32) };
+
+        // ... corrected for negative operands (two's complement), without branches
+        high -= ub & (0 - (ua >> 63));
+        high -= ua & (0 - (ub >> 63));
+
+        return { static_cast<std::int64_t>(high), low };
+#endif
+    }
+
+    // -1, 0 or 1 - evaluated without branches
+    inline int compare(const Int128& x, const Int128& y)
+    {
+        const int greater{ (x.m_high > y.m_high) | ((x.m_high == y.m_high) & (x.m_low > y.m_low)) };
+        const int less{ (x.m_high < y.m_high) | ((x.m_high == y.m_high) & (x.m_low < y.m_low)) };
+        return greater - less;
+    }
+
+    // -----------------------------------------------------------------------
+    // class Rational
+    //
+    // Invariants (established by the constructor):
+    //   * the denominator is positive
+    //   * numerator and denominator are coprime, zero is stored as 0/1
+    //
+    // Each value has exactly one representation: operator== may be defaulted
+    // and is consistent with operator<=>, which is a real std::strong_ordering.
+    // The cross products of the comparison are computed with 128 bits,
+    // they cannot overflow.
+
+    class Rational
+    {
+    private:
+        std::int64_t m_num;     // numerator
+        std::int64_t m_denom;   // denominator, always > 0
+
+    public:
+        // c'tors
+        Rational() : m_num{ 0 }, m_denom{ 1 } {}
+        Rational(std::int64_t num) : m_num{ num }, m_denom{ 1 } {}
+
+        Rational(std::int64_t num, std::int64_t denom)
+        {
+            if (denom == 0) {
+                throw std::invalid_argument{ "Rational: denominator is zero" };
+            }
+
+            // computed with magnitudes: -INT64_MIN isn't representable
+            const bool negative{ (num < 0) != (denom < 0) };
+
+            std::uint64_t n{ num < 0 ? 0 - static_cast<std::uint64_t>(num) : static_cast<std::uint64_t>(num) };
+            std::uint64_t d{ denom < 0 ? 0 - static_cast<std::uint64_t>(denom) : static_cast<std::uint64_t>(denom) };
+
+            const std::uint64_t divisor{ std::gcd(n, d) };
+            n /= divisor;
+            d /= divisor;
+
+            constexpr auto Max{ static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) };
+
+            if (d > Max || n > Max + negative) {
+                throw std::overflow_error{ "Rational: value not representable" };
+            }
+
+            m_num = negative ? static_cast<std::int64_t>(0 - n) : static_cast<std::int64_t>(n);
+            m_denom = static_cast<std::int64_t>(d);
+        }
+
+        // getter
+        std::int64_t numerator() const { return m_num; }
+        std::int64_t denominator() const { return m_denom; }
+
+        // comparison
+        bool operator==(const Rational& other) const = default;
+
+        // a/b <=> c/d  is  a*d <=> c*b,  since b > 0 and d > 0
+        std::strong_ordering operator<=>(const Rational& other) const {
+
+            const int result{ compare(multiply(m_num, other.m_denom), multiply(other.m_num, m_denom)) };
+            return result <=> 0;
+        }
+
+        // output operator
+        friend std::ostream& operator<< (std::ostream& os, const Rational& r)
+        {
+            os << r.m_num << '/' << r.m_denom;
+            return os;
+        }
+    };
+
+    void test_51()
+    {
+        // Fraction: equal values, different representations
+        Reference::Fraction f1{ 1, 2 };
+        Reference::Fraction f2{ 2, 4 };
+
+        std::cout << std::boolalpha;
+        std::cout << "Fraction: " << f1 << " == " << f2 << ": " << (f1 == f2) << std::endl;
+        std::cout << "Fraction: " << f1 << " >  " << f2 << ": " << (f1 > f2) << std::endl;
+        std::cout << "Fraction: " << f2 << " >  " << f1 << ": " << (f2 > f1) << std::endl;   // both 'greater' (!)
+
+        // Rational: canonicalized on construction
+        Rational r1{ 1, 2 };
+        Rational r2{ 2, 4 };
+        Rational r3{ -3, -6 };
+        Rational r4{ 3, -6 };
+
+        std::cout << "Rational: " << r1 << " == " << r2 << ": " << (r1 == r2) << std::endl;
+        std::cout << "Rational: " << r1 << " == " << r3 << ": " << (r1 == r3) << std::endl;
+        std::cout << "Rational: " << r4 << " <  " << r1 << ": " << (r4 < r1) << std::endl;
+    }
+
+    void test_52()
+    {
+        // cross products beyond 64 bit
+        constexpr std::int64_t Max{ std::numeric_limits<std::int64_t>::max() };
+        constexpr std::int64_t Min{ std::numeric_limits<std::int64_t>::min() };
+
+        Rational r1{ Max, Max - 1 };
+        Rational r2{ Max - 1, Max - 2 };
+        Rational r3{ Min, 3 };
+        Rational r4{ Min + 1, 3 };
+
+        std::cout << std::boolalpha;
+        std::cout << r1 << " < " << r2 << ": " << (r1 < r2) << std::endl;
+        std::cout << r3 << " < " << r4 << ": " << (r3 < r4) << std::endl;
+
+        try {
+            [[maybe_unused]] Rational r5{ 1, Min };      // denominator 2^63 isn't representable
+        }
+        catch (const std::overflow_error& ex) {
+            std::cout << ex.what() << std::endl;
+        }
+
+        // std::set: equivalent values are one key
+        std::set<Rational> numbers;
+
+        numbers.insert(Rational{ 3, 8 });
+        numbers.insert(Rational{ 1, 7 });
+        numbers.insert(Rational{ 2, 4 });
+        numbers.insert(Rational{ 1, 2 });
+        numbers.insert(Rational{ 2, 14 });
+
+        for (const auto& number : numbers) {
+            std::cout << number << std::endl;
+        }
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark: sorting and std::set with 10^7 elements
+
+    using Helpers::measure;
+
+    void test_53_benchmark()
+    {
+        constexpr std::size_t Count{ 10'000'000 };
+
+        // small values: the products of Fraction don't overflow
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> numerators{ -1000, 1000 };
+        std::uniform_int_distribution<int> denominators{ 1, 1000 };
+
+        std::vector<std::pair<int, int>> values(Count);
+        for (auto& [num, denom] : values) {
+            num = numerators(generator);
+            denom = denominators(generator);
+        }
+
+        std::cout << Count << " elements:" << std::endl;
+
+        std::vector<Reference::Fraction> fractions;
+        std::vector<Reference::SafeFraction> safeFractions;
+        std::vector<Rational> rationals;
+
+        measure("  construct Fraction:      ", [&] {
+            fractions.reserve(Count);
+            for (const auto& [num, denom] : values) {
+                fractions.emplace_back(num, denom);
+            }
+            return fractions.size();
+        });
+
+        measure("  construct SafeFraction:  ", [&] {
+            safeFractions.reserve(Count);
+            for (const auto& [num, denom] : values) {
+                safeFractions.emplace_back(num, denom);
+            }
+            return safeFractions.size();
+        });
+
+        measure("  construct Rational:      ", [&] {
+            rationals.reserve(Count);
+            for (const auto& [num, denom] : values) {
+                rationals.emplace_back(num, denom);
+            }
+            return rationals.size();
+        });
+
+        measure("  std::sort Fraction:      ", [&] {
+            std::sort(fractions.begin(), fractions.end());
+            return fractions.front();
+        });
+
+        measure("  std::sort SafeFraction:  ", [&] {
+            std::sort(safeFractions.begin(), safeFractions.end());
+            return safeFractions.front();
+        });
+
+        measure("  std::sort Rational:      ", [&] {
+            std::sort(rationals.begin(), rationals.end());
+            return rationals.front();
+        });
+
+        // the vectors are sorted now - shuffled again for the sets
+        std::shuffle(fractions.begin(), fractions.end(), generator);
+        std::shuffle(safeFractions.begin(), safeFractions.end(), generator);
+        std::shuffle(rationals.begin(), rationals.end(), generator);
+
+        measure("  std::set Fraction:       ", [&] {
+            std::set<Reference::Fraction> set(fractions.begin(), fractions.end());
+            return set.size();
+        });
+
+        measure("  std::set SafeFraction:   ", [&] {
+            std::set<Reference::SafeFraction> set(safeFractions.begin(), safeFractions.end());
+            return set.size();
+        });
+
+        measure("  std::set Rational:       ", [&] {
+            std::set<Rational> set(rationals.begin(), rationals.end());
+            return set.size();
+        });
+    }
+}
+
+// ===============================================================
+
+void test_spaceship_rational()
+{
+    using namespace Spaceship_05_Rational;
+    test_51();
+    test_52();
+    test_53_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
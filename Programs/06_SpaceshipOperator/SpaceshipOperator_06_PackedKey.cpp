@@ -0,0 +1,584 @@
+// ===========================================================================
+// SpaceshipOperator_06_PackedKey.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <string>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <tuple>
+#include <array>
+#include <utility>
+#include <limits>
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <ranges>
+#include <random>
+
+#include "Helpers.h"
+
+namespace Spaceship_06_PackedKey
+{
+    // -----------------------------------------------------------------------
+    // classes Point and PointEx (SpaceshipOperator.cpp, namespace Spaceship_03_Operator_Point)
+
+    namespace Reference
+    {
+        class Point {
+        private:
+            int m_x;
+            int m_y;
+
+        public:
+            Point() : Point{ 0, 0 } {}
+            Point(int x, int y) : m_x{ x }, m_y{ y } { };
+
+            auto operator<=>(const Point&) const = default;
+        };
+
+        class PointEx {
+        private:
+            int m_x;
+            int m_y;
+
+        public:
+            PointEx() : PointEx{ 0, 0 } {}
+            PointEx(int x, int y) : m_x{ x }, m_y{ y } { };
+
+            std::strong_ordering operator<=>(const PointEx& other) const {
+
+                if (m_x < other.m_x)
+                    return std::strong_ordering::less;
+
+                if (m_x > other.m_x)
+                    return std::strong_ordering::greater;
+
+                if (m_y < other.m_y)
+                    return std::strong_ordering::less;
+
+                if (m_y > other.m_y)
+                    return std::strong_ordering::greater;
+
+                return std::strong_ordering::equal;
+            }
+
+            bool operator==(const PointEx& other) const = default;
+        };
+    }
+
+    // -----------------------------------------------------------------------
+    // packed keys
+    //
+    // The fields of an aggregate with integral members are packed into one
+    // unsigned integer, the first field in the most significant bits.
+    // Signed fields are biased (sign bit flipped): the unsigned order of the
+    // biased values equals the signed order of the values.
+    // One integer comparison replaces the member-wise comparison of operator<=>.
+    //
+    // The packed ordering must match the ordering of operator<=> -
+    // this is checked at compile time (see details::matchesOrdering).
+
+#if defined(__SIZEOF_INT128__)
+    using uint128 = unsigned __int128;
+#else
+    // two words, compared in the order high, low
+    struct uint128
+    {
+        std::uint64_t m_high;
+        std::uint64_t m_low;
+
+        auto operator<=>(const uint128&) const = default;
+    };
+#endif
+
+    namespace details {
+
+        struct any_field
+        {
+            template <typename T>
+            operator T() const;     // declaration only, used in unevaluated context
+        };
+
+        template <typename T, typename... ARGS>
+        consteval std::size_t fieldCount()
+        {
+            if constexpr (sizeof...(ARGS) <= 4 && requires { T{ ARGS{}..., any_field{} }; }) {
+                return fieldCount<T, ARGS..., any_field>();
+            }
+            else {
+                return sizeof...(ARGS);
+            }
+        }
+
+        // copies of the fields of an aggregate (up to 4 fields)
+        template <typename T>
+        constexpr auto toTuple(const T& obj)
+        {
+            constexpr std::size_t count{ fieldCount<T>() };
+
+            if constexpr (count == 1) {
+                const auto& [m1] = obj;
+                return std::tuple{ m1 };
+            }
+            else if constexpr (count == 2) {
+                const auto& [m1, m2] = obj;
+                return std::tuple{ m1, m2 };
+            }
+            else if constexpr (count == 3) {
+                const auto& [m1, m2, m3] = obj;
+                return std::tuple{ m1, m2, m3 };
+            }
+            else if constexpr (count == 4) {
+                const auto& [m1, m2, m3, m4] = obj;
+                return std::tuple{ m1, m2, m3, m4 };
+            }
+        }
+
+        template <typename T>
+        using fields_t = decltype(toTuple(std::declval<const T&>()));
+
+        template <typename TTuple>
+        constexpr bool allIntegral{ false };
+
+        template <typename... TFields>
+        constexpr bool allIntegral<std::tuple<TFields...>>{ (std::integral<TFields> && ...) };
+
+        template <typename TTuple>
+        constexpr std::size_t totalBits{ 0 };
+
+        template <typename... TFields>
+        constexpr std::size_t totalBits<std::tuple<TFields...>>{ ((8 * sizeof(TFields)) + ...) };
+    }
+
+    template <typename T>
+    concept PackableAggregate =
+        std::is_aggregate_v<T> &&
+        std::three_way_comparable<T> &&
+        details::fieldCount<T>() >= 1 && details::fieldCount<T>() <= 4 &&
+        details::allIntegral<details::fields_t<T>> &&
+        details::totalBits<details::fields_t<T>> <= 128;
+
+    namespace details {
+
+        template <typename T>
+        using key_t = std::conditional_t<totalBits<fields_t<T>> <= 64, std::uint64_t, uint128>;
+
+        // bias: flipping the sign bit maps [min, max] monotonically onto [0, 2^bits - 1]
+        template <std::integral F>
+        constexpr std::uint64_t biased(F value)
+        {
+            if constexpr (std::same_as<F, bool>) {
+                return value;
+            }
+            else {
+                using U = std::make_unsigned_t<F>;
+                U bits{ static_cast<U>(value) };
+                if constexpr (std::is_signed_v<F>) {
+                    bits ^= U{ 1 } << (8 * sizeof(F) - 1);
+                }
+                return bits;
+            }
+        }
+
+        template <std::size_t Bits, typename K>
+        constexpr void shiftIn(K& key, std::uint64_t value)
+        {
+            if constexpr (std::same_as<K, std::uint64_t> && Bits == 64) {
+                key = value;    // the only field: a shift by 64 would be undefined
+            }
+            else if constexpr (std::same_as<K, std::uint64_t> || !std::is_class_v<K>) {
+                key = (key << Bits) | value;
+            }
+            else if constexpr (Bits == 64) {
+                key = { key.m_low, value };
+            }
+            else {
+                key = { (key.m_high << Bits) | (key.m_low >> (64 - Bits)), (key.m_low << Bits) | value };
+            }
+        }
+
+        // inverse operations: the least significant field first
+        template <std::integral F>
+        constexpr F unbiased(std::uint64_t bits)
+        {
+            if constexpr (std::same_as<F, bool>) {
+                return bits != 0;
+            }
+            else {
+                using U = std::make_unsigned_t<F>;
+                U value{ static_cast<U>(bits) };
+                if constexpr (std::is_signed_v<F>) {
+                    value ^= U{ 1 } << (8 * sizeof(F) - 1);
+                }
+                return static_cast<F>(value);
+            }
+        }
+
+        template <std::size_t Bits, typename K>
+        constexpr std::uint64_t shiftOut(K& key)
+        {
+            constexpr std::uint64_t Mask{ Bits == 64 ? ~std::uint64_t{} : (std::uint64_t{ 1 } << Bits) - 1 };
+
+            std::uint64_t value{};
+
+            if constexpr (std::same_as<K, std::uint64_t> && Bits == 64) {
+                value = key;
+                key = 0;
+            }
+            else if constexpr (std::same_as<K, std::uint64_t> || !std::is_class_v<K>) {
+                value = static_cast<std::uint64_t>(key) & Mask;
+                key >>= Bits;
+            }
+            else if constexpr (Bits == 64) {
+                value = key.m_low;
+                key = { 0, key.m_high };
+            }
+            else {
+                value = key.m_low & Mask;
+                key = { key.m_high >> Bits, (key.m_low >> Bits) | (key.m_high << (64 - Bits)) };
+            }
+
+            return value;
+        }
+    }
+
+    template <PackableAggregate T>
+    constexpr details::key_t<T> packed_key(const T& obj)
+    {
+        details::key_t<T> key{};
+
+        std::apply([&](const auto&... fields) {
+            (details::shiftIn<8 * sizeof(fields)>(key, details::biased(fields)), ...);
+        }, details::toTuple(obj));
+
+        return key;
+    }
+
+    // all bits of an integral field are part of the key: packing is lossless
+    template <PackableAggregate T>
+    constexpr T unpack(details::key_t<T> key)
+    {
+        using Fields = details::fields_t<T>;
+
+        constexpr std::size_t count{ std::tuple_size_v<Fields> };
+
+        Fields fields{};
+
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((std::get<count - 1 - Is>(fields) = details::unbiased<std::tuple_element_t<count - 1 - Is, Fields>>(
+                details::shiftOut<8 * sizeof(std::tuple_element_t<count - 1 - Is, Fields>)>(key))), ...);
+        }(std::make_index_sequence<count>{});
+
+        return std::make_from_tuple<T>(fields);
+    }
+
+    namespace details {
+
+        // compile time check: for each field K two objects are built,
+        // equal in the fields before K, with sample values in field K and
+        // opposite extreme values in the fields after K - field K must decide
+        // in both orderings the same way
+
+        template <typename F>
+        consteval std::array<F, 5> samples()
+        {
+            using limits = std::numeric_limits<F>;
+
+            if constexpr (std::same_as<F, bool>) {
+                return { false, false, true, true, true };
+            }
+            else if constexpr (std::is_signed_v<F>) {
+                return { limits::min(), F{ -1 }, F{ 0 }, F{ 1 }, limits::max() };
+            }
+            else {
+                return { F{ 0 }, F{ 1 }, static_cast<F>(limits::max() / 2 + 1), static_cast<F>(limits::max() - 1), limits::max() };
+            }
+        }
+
+        constexpr int sign(auto ordering)
+        {
+            return (ordering < 0) ? -1 : (ordering > 0) ? 1 : 0;
+        }
+
+        template <typename T, std::size_t K>
+        consteval bool matchesOrderingOfField()
+        {
+            using Fields = fields_t<T>;
+            using F = std::tuple_element_t<K, Fields>;
+
+            constexpr std::size_t count{ std::tuple_size_v<Fields> };
+
+            for (F a : samples<F>()) {
+                for (F b : samples<F>()) {
+                    for (bool ascending : { false, true }) {
+
+                        Fields x{};
+                        Fields y{};
+
+                        std::get<K>(x) = a;
+                        std::get<K>(y) = b;
+
+                        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                            ((Is > K ? (std::get<Is>(x) = ascending ? std::numeric_limits<std::tuple_element_t<Is, Fields>>::min() : std::numeric_limits<std::tuple_element_t<Is, Fields>>::max(),
+                                        std::get<Is>(y) = ascending ? std::numeric_limits<std::tuple_element_t<Is, Fields>>::max() : std::numeric_limits<std::tuple_element_t<Is, Fields>>::min(),
+                                        0) : 0), ...);
+                        }(std::make_index_sequence<count>{});
+
+                        const T tx{ std::make_from_tuple<T>(x) };
+                        const T ty{ std::make_from_tuple<T>(y) };
+
+                        if (sign(packed_key(tx) <=> packed_key(ty)) != sign(tx <=> ty)) {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        template <typename T>
+        consteval bool matchesOrdering()
+        {
+            return[]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+                return (matchesOrderingOfField<T, Ks>() && ...);
+            }(std::make_index_sequence<fieldCount<T>()>{});
+        }
+    }
+
+    // function objects for std::sort, std::set, ...
+    struct packed_less
+    {
+        template <PackableAggregate T>
+        constexpr bool operator()(const T& lhs, const T& rhs) const
+        {
+            static_assert(details::matchesOrdering<T>(), "packed ordering differs from operator<=>");
+            return packed_key(lhs) < packed_key(rhs);
+        }
+    };
+
+    struct packed_compare_three_way
+    {
+        template <PackableAggregate T>
+        constexpr std::strong_ordering operator()(const T& lhs, const T& rhs) const
+        {
+            static_assert(details::matchesOrdering<T>(), "packed ordering differs from operator<=>");
+            return packed_key(lhs) <=> packed_key(rhs);
+        }
+    };
+
+    // sorts the keys instead of the objects: a plain array of integers
+    template <std::ranges::random_access_range R>
+        requires std::ranges::sized_range<R> && PackableAggregate<std::ranges::range_value_t<R>>
+    void packed_sort(R&& range)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        static_assert(details::matchesOrdering<T>(), "packed ordering differs from operator<=>");
+
+        std::vector<details::key_t<T>> keys(std::ranges::size(range));
+        std::ranges::transform(range, keys.begin(), [](const T& obj) { return packed_key(obj); });
+
+        std::sort(keys.begin(), keys.end());
+
+        std::ranges::transform(keys, std::ranges::begin(range), [](const auto& key) { return unpack<T>(key); });
+    }
+
+    // -----------------------------------------------------------------------
+    // examples
+
+    struct Point
+    {
+        int m_x;
+        int m_y;
+
+        auto operator<=>(const Point&) const = default;
+    };
+
+    struct Pixel
+    {
+        std::uint16_t m_x;
+        std::uint16_t m_y;
+        std::uint8_t  m_layer;
+
+        auto operator<=>(const Pixel&) const = default;
+    };
+
+    struct Position
+    {
+        std::int64_t m_x;
+        std::int32_t m_y;
+        std::int16_t m_z;
+        bool         m_visible;
+
+        auto operator<=>(const Position&) const = default;
+    };
+
+    // hand-written operator<=>, m_y is compared first
+    struct PointYX
+    {
+        int m_x;
+        int m_y;
+
+        constexpr std::strong_ordering operator<=>(const PointYX& other) const {
+            if (auto cmp = m_y <=> other.m_y; cmp != 0) {
+                return cmp;
+            }
+            return m_x <=> other.m_x;
+        }
+
+        bool operator==(const PointYX&) const = default;
+    };
+
+    struct Circle
+    {
+        int    m_x;
+        int    m_y;
+        double m_radius;
+
+        auto operator<=>(const Circle&) const = default;
+    };
+
+    static_assert(PackableAggregate<Point> && std::same_as<details::key_t<Point>, std::uint64_t>);
+    static_assert(PackableAggregate<Pixel> && std::same_as<details::key_t<Pixel>, std::uint64_t>);
+    static_assert(PackableAggregate<Position> && std::same_as<details::key_t<Position>, uint128>);
+    static_assert(!PackableAggregate<Circle>);          // double isn't integral
+    static_assert(!PackableAggregate<Reference::Point>);  // not an aggregate
+
+    static_assert(details::matchesOrdering<Point>());
+    static_assert(details::matchesOrdering<Position>());
+    static_assert(!details::matchesOrdering<PointYX>()); // packed_less would be rejected
+
+    static_assert(unpack<Point>(packed_key(Point{ -7, 7 })) == Point{ -7, 7 });
+    static_assert(unpack<Position>(packed_key(Position{ -1, 2, -3, true })) == Position{ -1, 2, -3, true });
+
+    void test_61()
+    {
+        Point p1{ -1, 5 };
+        Point p2{ 1, -5 };
+        Point p3{ 1, 7 };
+
+        std::cout << std::boolalpha;
+        std::cout << (p1 < p2) << " - " << packed_less{}(p1, p2) << std::endl;
+        std::cout << (p2 < p3) << " - " << packed_less{}(p2, p3) << std::endl;
+        std::cout << (p3 < p1) << " - " << packed_less{}(p3, p1) << std::endl;
+
+        Position pos1{ -3'000'000'000, 10, -1, true };
+        Position pos2{ -3'000'000'000, 10, -1, false };
+        std::cout << ((pos1 <=> pos2) > 0) << " - " << (packed_compare_three_way{}(pos1, pos2) > 0) << std::endl;
+
+        std::set<Pixel, packed_less> pixels{ { 3, 4, 1 }, { 3, 4, 0 }, { 1, 9, 2 }, { 3, 4, 1 } };
+        for (const auto& [x, y, layer] : pixels) {
+            std::cout << '(' << x << ',' << y << ',' << static_cast<int>(layer) << ") ";
+        }
+        std::cout << std::endl;
+
+        std::vector<Point> points{ { 2, -1 }, { -2, 3 }, { 2, -5 }, { 0, 0 } };
+        packed_sort(points);
+        for (const auto& [x, y] : points) {
+            std::cout << '(' << x << ',' << y << ") ";
+        }
+        std::cout << std::endl;
+
+        // PointYX q1{ 1, 2 };
+        // PointYX q2{ 2, 1 };
+        // packed_less{}(q1, q2);   // error: packed ordering differs from operator<=>
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark: member-wise versus packed comparison
+
+    using Helpers::measure;
+
+    void test_62_benchmark()
+    {
+        constexpr std::size_t SortCount{ 10'000'000 };
+        constexpr std::size_t SetCount{ 1'000'000 };
+
+        // few different x values: the second member is compared often
+        std::mt19937 generator{ 1 };
+        std::uniform_int_distribution<int> xs{ -100, 100 };
+        std::uniform_int_distribution<int> ys{ std::numeric_limits<int>::min(), std::numeric_limits<int>::max() };
+
+        std::vector<Point> points(SortCount);
+        for (auto& [x, y] : points) {
+            x = xs(generator);
+            y = ys(generator);
+        }
+
+        std::vector<Reference::Point> pointsDefaulted;
+        std::vector<Reference::PointEx> pointsHandWritten;
+        pointsDefaulted.reserve(SortCount);
+        pointsHandWritten.reserve(SortCount);
+
+        for (const auto& [x, y] : points) {
+            pointsDefaulted.emplace_back(x, y);
+            pointsHandWritten.emplace_back(x, y);
+        }
+
+        std::cout << "std::sort, " << SortCount << " points:" << std::endl;
+
+        measure("  Point   (defaulted <=>):    ", [v = pointsDefaulted]() mutable {
+            std::sort(v.begin(), v.end());
+            return v.size();
+        });
+
+        measure("  PointEx (hand-written <=>): ", [v = pointsHandWritten]() mutable {
+            std::sort(v.begin(), v.end());
+            return v.size();
+        });
+
+        measure("  Point   (member-wise <):    ", [v = points]() mutable {
+            std::sort(v.begin(), v.end());
+            return v.front().m_x;
+        });
+
+        measure("  Point   (packed_less):      ", [v = points]() mutable {
+            std::sort(v.begin(), v.end(), packed_less{});
+            return v.front().m_x;
+        });
+
+        measure("  Point   (packed_sort):      ", [v = points]() mutable {
+            packed_sort(v);
+            return v.front().m_x;
+        });
+
+        std::cout << "std::set insert, " << SetCount << " points:" << std::endl;
+
+        measure("  Point   (defaulted <=>):    ", [&] {
+            std::set<Reference::Point> set(pointsDefaulted.begin(), pointsDefaulted.begin() + SetCount);
+            return set.size();
+        });
+
+        measure("  PointEx (hand-written <=>): ", [&] {
+            std::set<Reference::PointEx> set(pointsHandWritten.begin(), pointsHandWritten.begin() + SetCount);
+            return set.size();
+        });
+
+        measure("  Point   (member-wise <):    ", [&] {
+            std::set<Point> set(points.begin(), points.begin() + SetCount);
+            return set.size();
+        });
+
+        measure("  Point   (packed_less):      ", [&] {
+            std::set<Point, packed_less> set(points.begin(), points.begin() + SetCount);
+            return set.size();
+        });
+    }
+}
+
+// ===============================================================
+
+void test_spaceship_packed_key()
+{
+    using namespace Spaceship_06_PackedKey;
+    test_61();
+    test_62_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
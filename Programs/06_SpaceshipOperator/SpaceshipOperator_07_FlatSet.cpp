@@ -0,0 +1,552 @@
+// ===========================================================================
+// SpaceshipOperator_07_FlatSet.cpp
+// ===========================================================================
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <set>
+#include <vector>
+#include <span>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+
+#include "Helpers.h"
+
+namespace Spaceship_07_FlatSet
+{
+    // -----------------------------------------------------------------------
+    // class Point (SpaceshipOperator.cpp, namespace Spaceship_03_Operator_Point)
+    // class Fraction (SpaceshipOperator.cpp, namespace Spaceship_04_Operator_Fraction)
+
+    namespace Reference
+    {
+        class Point {
+        private:
+            int m_x;
+            int m_y;
+
+        public:
+            Point() : Point{ 0, 0 } {}
+            Point(int x, int y) : m_x{ x }, m_y{ y } { };
+
+            auto operator<=>(const Point&) const = default;
+        };
+
+        class Fraction
+        {
+        private:
+            int m_num;
+            int m_denom;
+
+        public:
+            Fraction() : m_num{ 0 }, m_denom{ 1 } { };
+            Fraction(int num, int denom) : m_num(num), m_denom(denom) { };
+
+            bool operator==(const Fraction& other) const = default;
+
+            std::strong_ordering operator<=>(const Fraction& other) const {
+
+                if (m_num == other.m_num && m_denom == other.m_denom) {
+                    return std::strong_ordering::equal;
+                }
+
+                if (m_num * other.m_denom < m_denom * other.m_num)
+                {
+                    return std::strong_ordering::less;
+                }
+                else {
+                    return std::strong_ordering::greater;
+                }
+            }
+
+            friend std::ostream& operator<< (std::ostream& os, const Fraction& f)
+            {
+                os << f.m_num << '/' << f.m_denom;
+                return os;
+            }
+        };
+    }
+
+    // -----------------------------------------------------------------------
+    // flat_set / flat_map: sorted keys in one contiguous std::vector
+    //
+    // The ordering is defined by a three-way comparison ('Compare' yields
+    // the result of operator<=>). Two keys are equivalent, if none is less
+    // than the other - as with std::set.
+    // std::compare_three_way is transparent: keys of a different type can be
+    // looked up (heterogeneous lookup), if they are three-way comparable with 'Key'.
+    //
+    // Single insertions move the elements behind the insertion point,
+    // bulk insertion appends the new elements to a copy of the existing ones,
+    // sorts them and merges them - duplicates are removed, existing keys win.
+    // The copy replaces the container only at the end (strong exception guarantee).
+
+    namespace details {
+
+        template <typename TComp, typename K, typename L>
+        bool less(const TComp& comp, const K& lhs, const L& rhs)
+        {
+            return comp(lhs, rhs) < 0;
+        }
+
+        // binary search without branches in the loop: the range is halved
+        // in each step, the comparison selects the base (conditional move)
+        template <typename TComp, typename K, typename L>
+        std::size_t lowerBound(const TComp& comp, const K* first, std::size_t count, const L& key)
+        {
+            if (count == 0) {
+                return 0;
+            }
+
+            const K* base{ first };
+
+            while (count > 1) {
+                const std::size_t half{ count / 2 };
+                base = less(comp, base[half], key) ? base + half : base;
+                count -= half;
+            }
+
+            return static_cast<std::size_t>(base - first) + less(comp, *base, key);
+        }
+
+        // sorts the new elements [middle, end), merges them with the sorted
+        // elements [begin, middle) and removes equivalent elements,
+        // the first one (the existing one, the one inserted first) is kept
+        template <typename TIter, typename TLess>
+        TIter mergeUnique(TIter begin, TIter middle, TIter end, TLess less)
+        {
+            std::stable_sort(middle, end, less);
+            std::inplace_merge(begin, middle, end, less);
+
+            return std::unique(begin, end, [&](const auto& lhs, const auto& rhs) {
+                return !less(lhs, rhs);
+            });
+        }
+    }
+
+    template <std::three_way_comparable Key, typename Compare = std::compare_three_way>
+    class flat_set
+    {
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using size_type = std::size_t;
+        using const_iterator = typename std::vector<Key>::const_iterator;
+        using iterator = const_iterator;
+
+    private:
+        std::vector<Key> m_keys;
+        Compare          m_comp;
+
+    public:
+        flat_set() = default;
+
+        flat_set(std::initializer_list<Key> keys)
+        {
+            insert(keys.begin(), keys.end());
+        }
+
+        // iterators (constant: the keys must stay sorted)
+        const_iterator begin() const { return m_keys.begin(); }
+        const_iterator end() const { return m_keys.end(); }
+
+        // capacity
+        bool empty() const { return m_keys.empty(); }
+        size_type size() const { return m_keys.size(); }
+        void reserve(size_type count) { m_keys.reserve(count); }
+        void clear() { m_keys.clear(); }
+
+        // access to the underlying container
+        std::span<const Key> keys() const { return m_keys; }
+
+        // modifiers
+        std::pair<iterator, bool> insert(const Key& key)
+        {
+            const size_type pos{ index(key) };
+
+            if (pos != m_keys.size() && !details::less(m_comp, key, m_keys[pos])) {
+                return { begin() + pos, false };
+            }
+
+            return { m_keys.insert(m_keys.begin() + pos, key), true };
+        }
+
+        // strong exception guarantee: the merge works on a copy of the keys
+        template <std::input_iterator TIter>
+        void insert(TIter first, TIter last)
+        {
+            std::vector<Key> keys{ m_keys };
+
+            const size_type size{ keys.size() };
+            keys.insert(keys.end(), first, last);
+
+            const auto end{ details::mergeUnique(keys.begin(), keys.begin() + size, keys.end(), keyLess()) };
+            keys.erase(end, keys.end());
+
+            m_keys.swap(keys);
+        }
+
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, Key>
+        void insert_range(R&& range)
+        {
+            insert(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        size_type erase(const K& key)
+        {
+            const auto it{ find(key) };
+            if (it == end()) {
+                return 0;
+            }
+
+            m_keys.erase(it);
+            return 1;
+        }
+
+        // lookup (heterogeneous)
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        const_iterator lower_bound(const K& key) const
+        {
+            return begin() + index(key);
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        const_iterator find(const K& key) const
+        {
+            const size_type pos{ index(key) };
+
+            if (pos != m_keys.size() && !details::less(m_comp, key, m_keys[pos])) {
+                return begin() + pos;
+            }
+
+            return end();
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        bool contains(const K& key) const
+        {
+            return find(key) != end();
+        }
+
+    private:
+        template <typename K>
+        size_type index(const K& key) const
+        {
+            return details::lowerBound(m_comp, m_keys.data(), m_keys.size(), key);
+        }
+
+        auto keyLess() const
+        {
+            return [this](const Key& lhs, const Key& rhs) { return details::less(m_comp, lhs, rhs); };
+        }
+    };
+
+    // keys and values in separate vectors: the search touches the keys only
+    template <std::three_way_comparable Key, typename T, typename Compare = std::compare_three_way>
+    class flat_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = std::size_t;
+
+    private:
+        std::vector<Key> m_keys;
+        std::vector<T>   m_values;
+        Compare          m_comp;
+
+    public:
+        flat_map() = default;
+
+        flat_map(std::initializer_list<std::pair<Key, T>> elements)
+        {
+            insert_range(elements);
+        }
+
+        // capacity
+        bool empty() const { return m_keys.empty(); }
+        size_type size() const { return m_keys.size(); }
+
+        void reserve(size_type count)
+        {
+            m_keys.reserve(count);
+            m_values.reserve(count);
+        }
+
+        void clear()
+        {
+            m_keys.clear();
+            m_values.clear();
+        }
+
+        // access to the underlying containers
+        std::span<const Key> keys() const { return m_keys; }
+        std::span<const T> values() const { return m_values; }
+
+        // modifiers
+        bool insert(const Key& key, const T& value)
+        {
+            const size_type pos{ index(key) };
+
+            if (pos != m_keys.size() && !details::less(m_comp, key, m_keys[pos])) {
+                return false;
+            }
+
+            m_keys.insert(m_keys.begin() + pos, key);
+
+            try {
+                m_values.insert(m_values.begin() + pos, value);
+            }
+            catch (...) {
+                m_keys.erase(m_keys.begin() + pos);     // keys and values stay in step
+                throw;
+            }
+
+            return true;
+        }
+
+        // strong exception guarantee: the merge works on copies of the existing
+        // elements, the new vectors replace the old ones only at the end
+        template <std::ranges::input_range R>
+            requires std::convertible_to<std::ranges::range_reference_t<R>, std::pair<Key, T>>
+        void insert_range(R&& range)
+        {
+            std::vector<std::pair<Key, T>> elements;
+            elements.reserve(m_keys.size());
+
+            for (size_type i{}; i != m_keys.size(); ++i) {
+                elements.emplace_back(m_keys[i], m_values[i]);
+            }
+
+            const size_type size{ elements.size() };
+            for (auto&& element : range) {
+                elements.push_back(std::forward<decltype(element)>(element));
+            }
+
+            auto pairLess = [this](const auto& lhs, const auto& rhs) {
+                return details::less(m_comp, lhs.first, rhs.first);
+            };
+
+            const auto end{ details::mergeUnique(elements.begin(), elements.begin() + size, elements.end(), pairLess) };
+
+            std::vector<Key> keys;
+            std::vector<T> values;
+            keys.reserve(end - elements.begin());
+            values.reserve(end - elements.begin());
+
+            for (auto it{ elements.begin() }; it != end; ++it) {
+                keys.push_back(std::move(it->first));
+                values.push_back(std::move(it->second));
+            }
+
+            m_keys.swap(keys);
+            m_values.swap(values);
+        }
+
+        // lookup (heterogeneous)
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        const T* find(const K& key) const
+        {
+            const size_type pos{ index(key) };
+
+            if (pos != m_keys.size() && !details::less(m_comp, key, m_keys[pos])) {
+                return &m_values[pos];
+            }
+
+            return nullptr;
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        T* find(const K& key)
+        {
+            return const_cast<T*>(std::as_const(*this).find(key));
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        bool contains(const K& key) const
+        {
+            return find(key) != nullptr;
+        }
+
+        template <typename K>
+            requires std::three_way_comparable_with<Key, K>
+        const T& at(const K& key) const
+        {
+            const T* value{ find(key) };
+            if (value == nullptr) {
+                throw std::out_of_range{ "flat_map::at: key not found" };
+            }
+            return *value;
+        }
+
+        T& operator[](const Key& key)
+        {
+            const size_type pos{ index(key) };
+
+            if (pos == m_keys.size() || details::less(m_comp, key, m_keys[pos])) {
+                m_keys.insert(m_keys.begin() + pos, key);
+
+                try {
+                    m_values.insert(m_values.begin() + pos, T{});
+                }
+                catch (...) {
+                    m_keys.erase(m_keys.begin() + pos);     // keys and values stay in step
+                    throw;
+                }
+            }
+
+            return m_values[pos];
+        }
+
+    private:
+        template <typename K>
+        size_type index(const K& key) const
+        {
+            return details::lowerBound(m_comp, m_keys.data(), m_keys.size(), key);
+        }
+    };
+
+    void test_71()
+    {
+        // Fraction: 1/2 and 2/4 are equivalent, the first one is kept (as with std::set)
+        flat_set<Reference::Fraction> numbers;
+
+        numbers.insert(Reference::Fraction{ 3, 8 });
+        numbers.insert(Reference::Fraction{ 1, 7 });
+        numbers.insert(Reference::Fraction{ 1, 2 });
+        numbers.insert(Reference::Fraction{ 1, 7 });
+        numbers.insert_range(std::vector<Reference::Fraction>{ { 2, 4 }, { 5, 6 }, { 1, 3 }, { 5, 6 } });
+
+        for (const auto& number : numbers) {
+            std::cout << number << ' ';
+        }
+        std::cout << std::endl;
+
+        // heterogeneous lookup: std::string_view without creating a std::string
+        flat_set<std::string> words{ "spaceship", "operator", "three", "way", "comparison" };
+
+        std::string_view word{ "three-way" };
+        std::cout << std::boolalpha;
+        std::cout << words.contains(word.substr(0, 5)) << std::endl;
+        std::cout << words.contains(word) << std::endl;
+
+        flat_map<std::string, int> years{ { "C++20", 2020 }, { "C++11", 2011 }, { "C++17", 2017 } };
+        years["C++23"] = 2023;
+        years.insert_range(std::vector<std::pair<std::string, int>>{ { "C++14", 2014 }, { "C++20", 0 } });
+
+        for (std::size_t i{}; i != years.size(); ++i) {
+            std::cout << years.keys()[i] << ": " << years.values()[i] << std::endl;
+        }
+
+        std::cout << years.at(std::string_view{ "C++20" }) << std::endl;
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark: insert and lookup, std::set versus flat_set
+
+    using Helpers::measure;
+
+    template <typename T>
+    void benchmark(const std::string& name, const std::vector<T>& values, const std::vector<T>& lookups)
+    {
+        std::cout << name << ": " << values.size() << " inserts, " << lookups.size() << " lookups" << std::endl;
+
+        std::set<T> set;
+        flat_set<T> flatSet;
+
+        measure("  std::set insert:         ", [&] {
+            for (const auto& value : values) {
+                set.insert(value);
+            }
+            return set.size();
+        });
+
+        measure("  flat_set insert_range:   ", [&] {
+            flatSet.insert_range(values);
+            return flatSet.size();
+        });
+
+        measure("  std::set contains:       ", [&] {
+            std::size_t found{};
+            for (const auto& value : lookups) {
+                found += set.contains(value);
+            }
+            return found;
+        });
+
+        measure("  flat_set contains:       ", [&] {
+            std::size_t found{};
+            for (const auto& value : lookups) {
+                found += flatSet.contains(value);
+            }
+            return found;
+        });
+    }
+
+    void test_72_benchmark()
+    {
+        constexpr std::size_t Count{ 1'000'000 };
+
+        std::mt19937 generator{ 1 };
+
+        // small values: the products of Fraction don't overflow
+        std::uniform_int_distribution<int> numerators{ -1000, 1000 };
+        std::uniform_int_distribution<int> denominators{ 1, 1000 };
+
+        std::vector<Reference::Fraction> fractions(Count);
+        std::vector<Reference::Fraction> fractionLookups(Count);
+
+        for (auto& f : fractions) {
+            f = { numerators(generator), denominators(generator) };
+        }
+        for (auto& f : fractionLookups) {
+            f = { numerators(generator), denominators(generator) };
+        }
+
+        std::uniform_int_distribution<int> coordinates{ -10'000, 10'000 };
+
+        std::vector<Reference::Point> points(Count);
+        std::vector<Reference::Point> pointLookups(Count);
+
+        for (auto& p : points) {
+            p = { coordinates(generator), coordinates(generator) };
+        }
+        for (std::size_t i{}; i != Count; ++i) {
+            // every second lookup is successful
+            pointLookups[i] = (i % 2 == 0) ? points[(i * 7919) % Count] : Reference::Point{ coordinates(generator), coordinates(generator) };
+        }
+
+        benchmark("Fraction", fractions, fractionLookups);
+        benchmark("Point", points, pointLookups);
+    }
+}
+
+// ===============================================================
+
+void test_spaceship_flat_set()
+{
+    using namespace Spaceship_07_FlatSet;
+    test_71();
+    test_72_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================
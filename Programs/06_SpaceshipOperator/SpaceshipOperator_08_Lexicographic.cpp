@@ -0,0 +1,301 @@
+// ===========================================================================
+// SpaceshipOperator_08_Lexicographic.cpp
+// ===========================================================================
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEXICOGRAPHIC_SSE2
+#include <immintrin.h>
+#endif
+
+#include <iostream>
+#include <string>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <random>
+
+#include "Helpers.h"
+
+namespace Spaceship_08_Lexicographic
+{
+    // -----------------------------------------------------------------------
+    // lexicographic_compare_three_way
+    //
+    // Same result as std::lexicographical_compare_three_way with the
+    // operator<=> of the elements - for contiguous ranges of trivially
+    // comparable types: two elements are equal, if their object representations
+    // are equal (integral types, enumerations, pointers - not floating point types).
+    //
+    //   * byte-ordered types (one byte, unsigned): the order of the bytes is the
+    //     order of the elements - std::memcmp does the whole job
+    //   * otherwise: the first mismatch is searched with SIMD instructions
+    //     (16 or 32 bytes per step), only this pair of elements is compared
+    //
+    // Strings (std::string, std::string_view) are compared like their own
+    // operator<=>: std::char_traits<char>::compare behaves like std::memcmp,
+    // the characters are compared as unsigned char - even if char is signed.
+    // Other ranges of char (std::vector<char>, ...) use the operator<=> of char.
+
+    template <typename T>
+    concept TriviallyComparable =
+        (std::integral<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+        std::three_way_comparable<T>;
+
+    template <typename T>
+    constexpr bool ByteOrdered{ false };
+
+    template <std::integral T>
+    constexpr bool ByteOrdered<T>{ sizeof(T) == 1 && std::is_unsigned_v<T> };
+
+    template <typename T>
+        requires std::is_enum_v<T>
+    constexpr bool ByteOrdered<T>{ ByteOrdered<std::underlying_type_t<T>> };
+
+    static_assert(ByteOrdered<unsigned char> && ByteOrdered<char8_t> && ByteOrdered<std::byte>);
+    static_assert(!ByteOrdered<signed char> && !ByteOrdered<int>);
+
+    // std::basic_string, std::basic_string_view with std::char_traits<char>
+    template <typename R>
+    concept CharTraitsString =
+        requires { typename R::traits_type; } &&
+        std::same_as<typename R::traits_type, std::char_traits<char>>;
+
+    namespace details {
+
+        // three-way comparison of two byte sequences, shorter prefix is less
+        inline std::strong_ordering compareBytes(const void* lhs, std::size_t lhsSize, const void* rhs, std::size_t rhsSize)
+        {
+            const std::size_t count{ std::min(lhsSize, rhsSize) };
+
+            const int result{ count == 0 ? 0 : std::memcmp(lhs, rhs, count) };
+            if (result != 0) {
+                return result <=> 0;
+            }
+
+            return lhsSize <=> rhsSize;
+        }
+
+        // index of the first element, that differs - or 'count'
+        template <TriviallyComparable T>
+        std::size_t mismatch(const T* lhs, const T* rhs, std::size_t count)
+        {
+            std::size_t i{};
+
+#if defined(__AVX2__)
+            if constexpr (32 % sizeof(T) == 0) {
+                constexpr std::size_t Block{ 32 / sizeof(T) };
+
+                for (; i + Block <= count; i += Block) {
+                    const __m256i a{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)) };
+                    const __m256i b{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)) };
+
+                    const auto equal{ static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))) };
+                    if (equal != 0xFFFF'FFFF) {
+                        return i + std::countr_one(equal) / sizeof(T);
+                    }
+                }
+            }
+#elif defined(LEXICOGRAPHIC_SSE2)
+            if constexpr (16 % sizeof(T) == 0) {
+                constexpr std::size_t Block{ 16 / sizeof(T) };
+
+                for (; i + Block <= count; i += Block) {
+                    const __m128i a{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)) };
+                    const __m128i b{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)) };
+
+                    const auto equal{ static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) };
+                    if (equal != 0xFFFF) {
+                        return i + std::countr_one(equal) / sizeof(T);
+                    }
+                }
+            }
+#endif
+            // remainder (or no SIMD support)
+            for (; i != count; ++i) {
+                if (lhs[i] != rhs[i]) {
+                    break;
+                }
+            }
+
+            return i;
+        }
+    }
+
+    template <TriviallyComparable T>
+    std::compare_three_way_result_t<T> lexicographic_compare_three_way(std::span<const T> lhs, std::span<const T> rhs)
+    {
+        if constexpr (ByteOrdered<T>) {
+            return details::compareBytes(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+        }
+        else {
+            const std::size_t count{ std::min(lhs.size(), rhs.size()) };
+
+            const std::size_t pos{ details::mismatch(lhs.data(), rhs.data(), count) };
+            if (pos != count) {
+                return std::compare_three_way{}(lhs[pos], rhs[pos]);
+            }
+
+            return lhs.size() <=> rhs.size();
+        }
+    }
+
+    template <std::ranges::contiguous_range R1, std::ranges::contiguous_range R2>
+        requires std::same_as<std::ranges::range_value_t<R1>, std::ranges::range_value_t<R2>> &&
+                 TriviallyComparable<std::ranges::range_value_t<R1>>
+    auto lexicographic_compare_three_way(const R1& lhs, const R2& rhs)
+    {
+        using T = std::ranges::range_value_t<R1>;
+
+        if constexpr (CharTraitsString<R1> || CharTraitsString<R2>) {
+            return details::compareBytes(
+                std::ranges::data(lhs), std::ranges::size(lhs),
+                std::ranges::data(rhs), std::ranges::size(rhs)
+            );
+        }
+        else {
+            return lexicographic_compare_three_way(std::span<const T>{ lhs }, std::span<const T>{ rhs });
+        }
+    }
+
+    // function object for std::sort, std::set, ...
+    struct lexicographic_less
+    {
+        template <typename R1, typename R2>
+        bool operator()(const R1& lhs, const R2& rhs) const
+            requires requires { lexicographic_compare_three_way(lhs, rhs); }
+        {
+            return lexicographic_compare_three_way(lhs, rhs) < 0;
+        }
+    };
+
+    void test_81()
+    {
+        // the examples of test_21
+        std::string str1{ "ABC" };
+        std::string str2{ "DEF" };
+
+        auto res2 = lexicographic_compare_three_way(str1, str2);
+
+        if (res2 < 0)
+            std::cout << "str1 < str2" << std::endl;
+        else if (res2 == 0)
+            std::cout << "str1 == str2" << std::endl;
+        else if (res2 > 0)
+            std::cout << "str1 > str2" << std::endl;
+
+        std::vector<int> vec1{ 4, 5 };
+        std::vector<int> vec2{ 1, 2, 3 };
+
+        auto res3 = lexicographic_compare_three_way(vec1, vec2);
+
+        if (res3 < 0)
+            std::cout << "vec1 < vec2" << std::endl;
+        else if (res3 == 0)
+            std::cout << "vec1 == vec2" << std::endl;
+        else if (res3 > 0)
+            std::cout << "vec1 > vec2" << std::endl;
+
+        // mismatch behind the first SIMD block, negative values, prefixes
+        std::vector<int> vec3(100, 7);
+        std::vector<int> vec4(100, 7);
+        vec4[50] = -1;
+
+        std::cout << std::boolalpha;
+        std::cout << ((vec3 <=> vec4) > 0) << " - " << (lexicographic_compare_three_way(vec3, vec4) > 0) << std::endl;
+
+        vec4.resize(40);
+        std::cout << ((vec3 <=> vec4) > 0) << " - " << (lexicographic_compare_three_way(vec3, vec4) > 0) << std::endl;
+
+        // byte-ordered: std::memcmp
+        std::vector<std::byte> bytes1{ std::byte{ 0x01 }, std::byte{ 0xFF } };
+        std::vector<std::byte> bytes2{ std::byte{ 0x01 }, std::byte{ 0x02 }, std::byte{ 0x03 } };
+        std::cout << ((bytes1 <=> bytes2) > 0) << " - " << (lexicographic_compare_three_way(bytes1, bytes2) > 0) << std::endl;
+
+        // strings: characters compared as unsigned char, also where char is signed
+        std::string str3{ "\x80" };
+        std::string str4{ "A" };
+        std::cout << ((str3 <=> str4) > 0) << " - " << (lexicographic_compare_three_way(str3, str4) > 0) << std::endl;
+        std::cout << ((str3 <=> str4) > 0) << " - " << (lexicographic_compare_three_way(str3, std::string_view{ str4 }) > 0) << std::endl;
+
+        // other ranges of char: operator<=> of char
+        std::vector<char> chars1{ str3.begin(), str3.end() };
+        std::vector<char> chars2{ str4.begin(), str4.end() };
+        std::cout << ((chars1 <=> chars2) > 0) << " - " << (lexicographic_compare_three_way(chars1, chars2) > 0) << std::endl;
+    }
+
+    // -----------------------------------------------------------------------
+    // benchmark: sorting and removing duplicates of large keys with long common prefixes
+
+    using Helpers::measure;
+
+    template <typename T>
+    std::vector<std::vector<T>> makeKeys(std::size_t count, std::size_t length, std::mt19937& generator)
+    {
+        // keys differ in the last quarter only, every key appears twice
+        std::uniform_int_distribution<int> distribution{ 0, 3 };
+
+        std::vector<std::vector<T>> keys(count);
+
+        for (std::size_t i{}; i != count; i += 2) {
+            keys[i].assign(length, T{ 1 });
+            for (std::size_t k{ 3 * length / 4 }; k != length; ++k) {
+                keys[i][k] = static_cast<T>(distribution(generator));
+            }
+            keys[i + 1] = keys[i];
+        }
+
+        std::shuffle(keys.begin(), keys.end(), generator);
+        return keys;
+    }
+
+    template <typename T>
+    void benchmark(const std::string& name, const std::vector<std::vector<T>>& keys)
+    {
+        std::cout << keys.size() << " keys, vector<" << name << "> of " << keys[0].size() << " elements:" << std::endl;
+
+        measure("  std::sort + std::unique (operator<):          ", [v = keys]() mutable {
+            std::sort(v.begin(), v.end());
+            return std::unique(v.begin(), v.end()) - v.begin();
+        });
+
+        measure("  std::sort + std::unique (lexicographic_less): ", [v = keys]() mutable {
+            std::sort(v.begin(), v.end(), lexicographic_less{});
+            return std::unique(v.begin(), v.end(), [](const auto& lhs, const auto& rhs) {
+                return lexicographic_compare_three_way(lhs, rhs) == 0;
+            }) - v.begin();
+        });
+    }
+
+    void test_82_benchmark()
+    {
+        constexpr std::size_t Count{ 200'000 };
+        constexpr std::size_t Length{ 256 };
+
+        std::mt19937 generator{ 1 };
+
+        benchmark("int", makeKeys<int>(Count, Length, generator));
+        benchmark("std::uint16_t", makeKeys<std::uint16_t>(Count, Length, generator));
+        benchmark("unsigned char", makeKeys<unsigned char>(Count, Length, generator));
+    }
+}
+
+// ===============================================================
+
+void test_spaceship_lexicographic()
+{
+    using namespace Spaceship_08_Lexicographic;
+    test_81();
+    test_82_benchmark();
+}
+
+// ===========================================================================
+// End-of-File
+// ===========================================================================